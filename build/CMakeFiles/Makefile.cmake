@@ -0,0 +1,95 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/BuildOpts.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/ast/CMakeLists.txt"
+  "/root/repo/src/common/CMakeLists.txt"
+  "/root/repo/src/kata/CMakeLists.txt"
+  "/root/repo/src/parse/CMakeLists.txt"
+  "/root/repo/src/pass/CMakeLists.txt"
+  "/root/repo/src/scanner/CMakeLists.txt"
+  "/root/repo/src/symbols/CMakeLists.txt"
+  "/root/repo/src/tokens/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/bench/CMakeLists.txt"
+  "/root/repo/test/parse/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tokens/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/scanner/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/parse/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/symbols/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/pass/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/kata/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/parse/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/format.dir/DependInfo.cmake"
+  "CMakeFiles/testing.dir/DependInfo.cmake"
+  "src/tokens/CMakeFiles/tokens.dir/DependInfo.cmake"
+  "src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  "src/scanner/CMakeFiles/scan.dir/DependInfo.cmake"
+  "src/parse/CMakeFiles/parse.dir/DependInfo.cmake"
+  "src/symbols/CMakeFiles/symbols.dir/DependInfo.cmake"
+  "src/ast/CMakeFiles/ast.dir/DependInfo.cmake"
+  "src/pass/CMakeFiles/pass.dir/DependInfo.cmake"
+  "src/kata/CMakeFiles/kata.dir/DependInfo.cmake"
+  "test/parse/CMakeFiles/parse_test.dir/DependInfo.cmake"
+  "test/bench/CMakeFiles/scan_bench.dir/DependInfo.cmake"
+  "test/bench/CMakeFiles/hash_bench.dir/DependInfo.cmake"
+  "test/bench/CMakeFiles/bench.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testing"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/testing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ast/ast.c" "src/ast/CMakeFiles/ast.dir/ast.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast.c.o.d"
+  "/root/repo/build/src/ast/ast_reach.c" "src/ast/CMakeFiles/ast.dir/ast_reach.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_reach.c.o.d"
+  "/root/repo/build/src/ast/ast_schema.c" "src/ast/CMakeFiles/ast.dir/ast_schema.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/ast_schema.c.o.d"
+  "/root/repo/src/ast/compound.c" "src/ast/CMakeFiles/ast.dir/compound.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/compound.c.o.d"
+  "/root/repo/src/ast/except.c" "src/ast/CMakeFiles/ast.dir/except.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/except.c.o.d"
+  "/root/repo/src/ast/expr.c" "src/ast/CMakeFiles/ast.dir/expr.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/expr.c.o.d"
+  "/root/repo/src/ast/flow.c" "src/ast/CMakeFiles/ast.dir/flow.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/flow.c.o.d"
+  "/root/repo/src/ast/func.c" "src/ast/CMakeFiles/ast.dir/func.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/func.c.o.d"
+  "/root/repo/src/ast/func_body.c" "src/ast/CMakeFiles/ast.dir/func_body.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/func_body.c.o.d"
+  "/root/repo/src/ast/import.c" "src/ast/CMakeFiles/ast.dir/import.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/import.c.o.d"
+  "/root/repo/src/ast/list.c" "src/ast/CMakeFiles/ast.dir/list.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/list.c.o.d"
+  "/root/repo/src/ast/literals.c" "src/ast/CMakeFiles/ast.dir/literals.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/literals.c.o.d"
+  "/root/repo/src/ast/loop.c" "src/ast/CMakeFiles/ast.dir/loop.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/loop.c.o.d"
+  "/root/repo/src/ast/module.c" "src/ast/CMakeFiles/ast.dir/module.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/module.c.o.d"
+  "/root/repo/src/ast/pool.c" "src/ast/CMakeFiles/ast.dir/pool.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/pool.c.o.d"
+  "/root/repo/src/ast/strg.c" "src/ast/CMakeFiles/ast.dir/strg.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/strg.c.o.d"
+  "/root/repo/src/ast/vars.c" "src/ast/CMakeFiles/ast.dir/vars.c.o" "gcc" "src/ast/CMakeFiles/ast.dir/vars.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libast.a"
+  "/root/repo/lib/libast.pdb"
+  "CMakeFiles/ast.dir/ast.c.o"
+  "CMakeFiles/ast.dir/ast.c.o.d"
+  "CMakeFiles/ast.dir/ast_reach.c.o"
+  "CMakeFiles/ast.dir/ast_reach.c.o.d"
+  "CMakeFiles/ast.dir/ast_schema.c.o"
+  "CMakeFiles/ast.dir/ast_schema.c.o.d"
+  "CMakeFiles/ast.dir/compound.c.o"
+  "CMakeFiles/ast.dir/compound.c.o.d"
+  "CMakeFiles/ast.dir/except.c.o"
+  "CMakeFiles/ast.dir/except.c.o.d"
+  "CMakeFiles/ast.dir/expr.c.o"
+  "CMakeFiles/ast.dir/expr.c.o.d"
+  "CMakeFiles/ast.dir/flow.c.o"
+  "CMakeFiles/ast.dir/flow.c.o.d"
+  "CMakeFiles/ast.dir/func.c.o"
+  "CMakeFiles/ast.dir/func.c.o.d"
+  "CMakeFiles/ast.dir/func_body.c.o"
+  "CMakeFiles/ast.dir/func_body.c.o.d"
+  "CMakeFiles/ast.dir/import.c.o"
+  "CMakeFiles/ast.dir/import.c.o.d"
+  "CMakeFiles/ast.dir/list.c.o"
+  "CMakeFiles/ast.dir/list.c.o.d"
+  "CMakeFiles/ast.dir/literals.c.o"
+  "CMakeFiles/ast.dir/literals.c.o.d"
+  "CMakeFiles/ast.dir/loop.c.o"
+  "CMakeFiles/ast.dir/loop.c.o.d"
+  "CMakeFiles/ast.dir/module.c.o"
+  "CMakeFiles/ast.dir/module.c.o.d"
+  "CMakeFiles/ast.dir/pool.c.o"
+  "CMakeFiles/ast.dir/pool.c.o.d"
+  "CMakeFiles/ast.dir/strg.c.o"
+  "CMakeFiles/ast.dir/strg.c.o.d"
+  "CMakeFiles/ast.dir/vars.c.o"
+  "CMakeFiles/ast.dir/vars.c.o.d"
+  "ast_reach.c"
+  "ast_schema.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,78 @@
+/* This file is generated with a script. Do not edit. */
+#include <stdint.h>
+
+#include "ast.h"
+
+const uint32_t ast_reach[AST_LAST - AST_FIRST][AST_REACH_WORDS] = {
+    [AST_module - AST_FIRST] = {0xffbfffff, 0xbfffffff, 0x0000007f},
+    [AST_module_item - AST_FIRST] = {0xffbfffff, 0xbfffffff, 0x0000007f},
+    [AST_namespace_item - AST_FIRST] = {0xffbffffc, 0xb9ffffff, 0x0000007f},
+    [AST_namespace_definition - AST_FIRST] = {0xffbffffc, 0xb9ffffff, 0x0000007f},
+    [AST_class_item - AST_FIRST] = {0x1c009650, 0x80000000, 0x00000008},
+    [AST_class_definition - AST_FIRST] = {0x1c009670, 0x80000000, 0x00000008},
+    [AST_compound_name - AST_FIRST] = {0x00000040, 0x00000000, 0x00000000},
+    [AST_compound_ref_item - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_compound_reference - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_scope_operator - AST_FIRST] = {0x00000200, 0x00000000, 0x00000000},
+    [AST_literal_type_name - AST_FIRST] = {0x00000400, 0x00000000, 0x00000000},
+    [AST_literal_value - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_type_name - AST_FIRST] = {0x00001440, 0x00000000, 0x00000000},
+    [AST_formatted_strg - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_string_literal - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_var_decl - AST_FIRST] = {0x00009440, 0x00000000, 0x00000000},
+    [AST_var_decl_list - AST_FIRST] = {0x00019440, 0x00000000, 0x00000000},
+    [AST_var_definition - AST_FIRST] = {0x003efdc0, 0xb80000f0, 0x00000005},
+    [AST_list_init - AST_FIRST] = {0x003c7dc0, 0xb80000f0, 0x00000005},
+    [AST_dict_init_element - AST_FIRST] = {0x003c7dc0, 0xb80000f0, 0x00000005},
+    [AST_dict_init - AST_FIRST] = {0x003c7dc0, 0xb80000f0, 0x00000005},
+    [AST_array_param - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_array_reference - AST_FIRST] = {0x00606980, 0x18000070, 0x00000004},
+    [AST_function_reference - AST_FIRST] = {0x00a069c0, 0x18000070, 0x00000006},
+    [AST_create_reference - AST_FIRST] = {0x41206980, 0x18000070, 0x00000004},
+    [AST_destroy_reference - AST_FIRST] = {0x82000000, 0x00000000, 0x00000000},
+    [AST_function_declaration - AST_FIRST] = {0x04001440, 0x80000000, 0x00000000},
+    [AST_create_declaration - AST_FIRST] = {0x08001440, 0x80000000, 0x00000000},
+    [AST_destroy_declaration - AST_FIRST] = {0x10000000, 0x00000000, 0x00000000},
+    [AST_function_definition - AST_FIRST] = {0xe3bffdc0, 0xb9fffffc, 0x00000077},
+    [AST_create_name - AST_FIRST] = {0x40000000, 0x00000000, 0x00000000},
+    [AST_destroy_name - AST_FIRST] = {0x80000000, 0x00000000, 0x00000000},
+    [AST_create_definition - AST_FIRST] = {0xc3bffdc0, 0xb9fffffd, 0x00000077},
+    [AST_destroy_definition - AST_FIRST] = {0xc3befdc0, 0xb9fffffe, 0x00000077},
+    [AST_function_body - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_function_body_element - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_expression - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_expr_primary - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_expression_list - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_assignment_item - AST_FIRST] = {0x003c7dc0, 0xb80000f0, 0x00000005},
+    [AST_assignment - AST_FIRST] = {0x003c7dc0, 0xb80001f0, 0x00000005},
+    [AST_while_definition - AST_FIRST] = {0x00206980, 0x18000270, 0x00000004},
+    [AST_while_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_do_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_for_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_if_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_else_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_elif_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_try_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_except_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_final_clause - AST_FIRST] = {0xc3befdc0, 0xb9fffffc, 0x00000077},
+    [AST_break_statement - AST_FIRST] = {0x00000000, 0x00080000, 0x00000000},
+    [AST_continue_statement - AST_FIRST] = {0x00000000, 0x00100000, 0x00000000},
+    [AST_inline_statement - AST_FIRST] = {0x00000000, 0x00200000, 0x00000000},
+    [AST_yield_statement - AST_FIRST] = {0x00206980, 0x18400070, 0x00000004},
+    [AST_return_statement - AST_FIRST] = {0x00000000, 0x00800000, 0x00000000},
+    [AST_raise_statement - AST_FIRST] = {0x00206980, 0x19000070, 0x00000004},
+    [AST_start_function - AST_FIRST] = {0xc3befdc0, 0xbbfffffc, 0x00000077},
+    [AST_import_statement - AST_FIRST] = {0xffbfffff, 0xbfffffff, 0x0000007f},
+    [AST_expr_binary - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_expr_unary - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_cast_statement - AST_FIRST] = {0x00207dc0, 0x38000070, 0x00000004},
+    [AST_case_item - AST_FIRST] = {0x00000000, 0x40000000, 0x00000000},
+    [AST_type_name_list - AST_FIRST] = {0x00001440, 0x80000000, 0x00000000},
+    [AST_function_assignment - AST_FIRST] = {0x00207dc0, 0x98000070, 0x00000005},
+    [AST_compound_name_list - AST_FIRST] = {0x00000040, 0x00000000, 0x00000002},
+    [AST_array_param_list - AST_FIRST] = {0x00206980, 0x18000070, 0x00000004},
+    [AST_class_var_declaration - AST_FIRST] = {0x00009440, 0x00000000, 0x00000008},
+    [AST_print_statement - AST_FIRST] = {0x00206980, 0x18000070, 0x00000014},
+    [AST_trace_statement - AST_FIRST] = {0x00206980, 0x18000070, 0x00000024},
+    [AST_exit_statement - AST_FIRST] = {0x00206980, 0x18000070, 0x00000044},
+};
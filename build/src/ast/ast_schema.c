@@ -0,0 +1,419 @@
+/* This file is generated with a script. Do not edit. */
+#include <stddef.h>
+
+#include "ast.h"
+#include "pool.h"
+
+static const AstField fields_module[] = {
+    {offsetof(ast_module, list), POOL_LIST},
+};
+
+static const AstField fields_module_item[] = {
+    {offsetof(ast_module_item, nterm), POOL_NODE},
+    {offsetof(ast_module_item, scope), POOL_INT},
+};
+
+static const AstField fields_namespace_item[] = {
+    {offsetof(ast_namespace_item, nterm), POOL_NODE},
+    {offsetof(ast_namespace_item, scope), POOL_INT},
+};
+
+static const AstField fields_namespace_definition[] = {
+    {offsetof(ast_namespace_definition, name), POOL_TOKEN},
+    {offsetof(ast_namespace_definition, list), POOL_LIST},
+    {offsetof(ast_namespace_definition, scope), POOL_INT},
+    {offsetof(ast_namespace_definition, context), POOL_SKIP},
+};
+
+static const AstField fields_class_item[] = {
+    {offsetof(ast_class_item, nterm), POOL_NODE},
+    {offsetof(ast_class_item, scope), POOL_INT},
+};
+
+static const AstField fields_class_definition[] = {
+    {offsetof(ast_class_definition, name), POOL_TOKEN},
+    {offsetof(ast_class_definition, parent), POOL_NODE},
+    {offsetof(ast_class_definition, list), POOL_LIST},
+    {offsetof(ast_class_definition, scope), POOL_INT},
+    {offsetof(ast_class_definition, context), POOL_SKIP},
+};
+
+static const AstField fields_compound_name[] = {
+    {offsetof(ast_compound_name, list), POOL_LIST},
+    {offsetof(ast_compound_name, raw_name), POOL_STRING},
+};
+
+static const AstField fields_compound_ref_item[] = {
+    {offsetof(ast_compound_ref_item, symb), POOL_TOKEN},
+    {offsetof(ast_compound_ref_item, apar), POOL_NODE},
+};
+
+static const AstField fields_compound_reference[] = {
+    {offsetof(ast_compound_reference, list), POOL_LIST},
+};
+
+static const AstField fields_scope_operator[] = {
+    {offsetof(ast_scope_operator, token), POOL_TOKEN},
+};
+
+static const AstField fields_literal_type_name[] = {
+    {offsetof(ast_literal_type_name, token), POOL_TOKEN},
+};
+
+static const AstField fields_literal_value[] = {
+    {offsetof(ast_literal_value, token), POOL_TOKEN},
+    {offsetof(ast_literal_value, str), POOL_NODE},
+    {offsetof(ast_literal_value, value), POOL_QUAD},
+};
+
+static const AstField fields_type_name[] = {
+    {offsetof(ast_type_name, nterm), POOL_NODE},
+};
+
+static const AstField fields_formatted_strg[] = {
+    {offsetof(ast_formatted_strg, str), POOL_TOKEN},
+    {offsetof(ast_formatted_strg, exprs), POOL_NODE},
+};
+
+static const AstField fields_string_literal[] = {
+    {offsetof(ast_string_literal, literal), POOL_TOKEN},
+    {offsetof(ast_string_literal, fmt), POOL_NODE},
+};
+
+static const AstField fields_var_decl[] = {
+    {offsetof(ast_var_decl, is_const), POOL_BOOL},
+    {offsetof(ast_var_decl, type), POOL_NODE},
+    {offsetof(ast_var_decl, name), POOL_TOKEN},
+    {offsetof(ast_var_decl, context), POOL_SKIP},
+};
+
+static const AstField fields_var_decl_list[] = {
+    {offsetof(ast_var_decl_list, list), POOL_LIST},
+};
+
+static const AstField fields_var_definition[] = {
+    {offsetof(ast_var_definition, type), POOL_NODE},
+    {offsetof(ast_var_definition, item), POOL_NODE},
+    {offsetof(ast_var_definition, is_assigned), POOL_BOOL},
+};
+
+static const AstField fields_list_init[] = {
+    {offsetof(ast_list_init, list), POOL_LIST},
+};
+
+static const AstField fields_dict_init_element[] = {
+    {offsetof(ast_dict_init_element, key), POOL_TOKEN},
+    {offsetof(ast_dict_init_element, item), POOL_NODE},
+};
+
+static const AstField fields_dict_init[] = {
+    {offsetof(ast_dict_init, list), POOL_LIST},
+};
+
+static const AstField fields_array_param[] = {
+    {offsetof(ast_array_param, nterm), POOL_NODE},
+};
+
+static const AstField fields_array_reference[] = {
+    {offsetof(ast_array_reference, symbol), POOL_TOKEN},
+    {offsetof(ast_array_reference, param), POOL_NODE},
+};
+
+static const AstField fields_function_reference[] = {
+    {offsetof(ast_function_reference, name), POOL_NODE},
+    {offsetof(ast_function_reference, inp), POOL_NODE},
+    {offsetof(ast_function_reference, outp), POOL_NODE},
+};
+
+static const AstField fields_create_reference[] = {
+    {offsetof(ast_create_reference, name), POOL_NODE},
+    {offsetof(ast_create_reference, inp), POOL_NODE},
+};
+
+static const AstField fields_destroy_reference[] = {
+    {offsetof(ast_destroy_reference, name), POOL_NODE},
+};
+
+static const AstField fields_function_declaration[] = {
+    {offsetof(ast_function_declaration, name), POOL_TOKEN},
+    {offsetof(ast_function_declaration, is_virtual), POOL_BOOL},
+    {offsetof(ast_function_declaration, inputs), POOL_NODE},
+    {offsetof(ast_function_declaration, outputs), POOL_NODE},
+};
+
+static const AstField fields_create_declaration[] = {
+    {offsetof(ast_create_declaration, is_virtual), POOL_BOOL},
+    {offsetof(ast_create_declaration, inputs), POOL_NODE},
+};
+
+static const AstField fields_destroy_declaration[] = {
+    {offsetof(ast_destroy_declaration, is_virtual), POOL_BOOL},
+};
+
+static const AstField fields_function_definition[] = {
+    {offsetof(ast_function_definition, is_virtual), POOL_BOOL},
+    {offsetof(ast_function_definition, name), POOL_NODE},
+    {offsetof(ast_function_definition, inputs), POOL_NODE},
+    {offsetof(ast_function_definition, outputs), POOL_NODE},
+    {offsetof(ast_function_definition, body), POOL_NODE},
+};
+
+static const AstField fields_create_name[] = {
+    {offsetof(ast_create_name, list), POOL_LIST},
+};
+
+static const AstField fields_destroy_name[] = {
+    {offsetof(ast_destroy_name, list), POOL_LIST},
+};
+
+static const AstField fields_create_definition[] = {
+    {offsetof(ast_create_definition, is_virtual), POOL_BOOL},
+    {offsetof(ast_create_definition, name), POOL_NODE},
+    {offsetof(ast_create_definition, inputs), POOL_NODE},
+    {offsetof(ast_create_definition, body), POOL_NODE},
+};
+
+static const AstField fields_destroy_definition[] = {
+    {offsetof(ast_destroy_definition, is_virtual), POOL_BOOL},
+    {offsetof(ast_destroy_definition, name), POOL_NODE},
+    {offsetof(ast_destroy_definition, body), POOL_NODE},
+};
+
+static const AstField fields_function_body[] = {
+    {offsetof(ast_function_body, list), POOL_LIST},
+    {offsetof(ast_function_body, lazy), POOL_TOKEN},
+    {offsetof(ast_function_body, lazy_offset), POOL_INT},
+    {offsetof(ast_function_body, lazy_end), POOL_INT},
+};
+
+static const AstField fields_function_body_element[] = {
+    {offsetof(ast_function_body_element, nterm), POOL_NODE},
+};
+
+static const AstField fields_expression[] = {
+    {offsetof(ast_expression, expr), POOL_NODE},
+    {offsetof(ast_expression, expr_type), POOL_INT},
+    {offsetof(ast_expression, operand_type), POOL_INT},
+};
+
+static const AstField fields_expr_primary[] = {
+    {offsetof(ast_expr_primary, nterm), POOL_NODE},
+};
+
+static const AstField fields_expression_list[] = {
+    {offsetof(ast_expression_list, list), POOL_LIST},
+};
+
+static const AstField fields_assignment_item[] = {
+    {offsetof(ast_assignment_item, nterm), POOL_NODE},
+};
+
+static const AstField fields_assignment[] = {
+    {offsetof(ast_assignment, lhs), POOL_NODE},
+    {offsetof(ast_assignment, rhs), POOL_NODE},
+    {offsetof(ast_assignment, oper), POOL_TOKEN},
+};
+
+static const AstField fields_while_definition[] = {
+    {offsetof(ast_while_definition, expr), POOL_NODE},
+};
+
+static const AstField fields_while_clause[] = {
+    {offsetof(ast_while_clause, nterm), POOL_NODE},
+    {offsetof(ast_while_clause, body), POOL_NODE},
+};
+
+static const AstField fields_do_clause[] = {
+    {offsetof(ast_do_clause, nterm), POOL_NODE},
+    {offsetof(ast_do_clause, body), POOL_NODE},
+};
+
+static const AstField fields_for_clause[] = {
+    {offsetof(ast_for_clause, symbol), POOL_TOKEN},
+    {offsetof(ast_for_clause, type), POOL_NODE},
+    {offsetof(ast_for_clause, expr), POOL_NODE},
+    {offsetof(ast_for_clause, body), POOL_NODE},
+};
+
+static const AstField fields_if_clause[] = {
+    {offsetof(ast_if_clause, expr), POOL_NODE},
+    {offsetof(ast_if_clause, fbod), POOL_NODE},
+    {offsetof(ast_if_clause, eclaus), POOL_NODE},
+    {offsetof(ast_if_clause, elif_list), POOL_LIST},
+};
+
+static const AstField fields_else_clause[] = {
+    {offsetof(ast_else_clause, fbod), POOL_NODE},
+};
+
+static const AstField fields_elif_clause[] = {
+    {offsetof(ast_elif_clause, expr), POOL_NODE},
+    {offsetof(ast_elif_clause, fbod), POOL_NODE},
+};
+
+static const AstField fields_try_clause[] = {
+    {offsetof(ast_try_clause, fbod), POOL_NODE},
+    {offsetof(ast_try_clause, final), POOL_NODE},
+    {offsetof(ast_try_clause, except_list), POOL_LIST},
+};
+
+static const AstField fields_except_clause[] = {
+    {offsetof(ast_except_clause, name), POOL_TOKEN},
+    {offsetof(ast_except_clause, msg), POOL_TOKEN},
+    {offsetof(ast_except_clause, fbod), POOL_NODE},
+};
+
+static const AstField fields_final_clause[] = {
+    {offsetof(ast_final_clause, msg), POOL_TOKEN},
+    {offsetof(ast_final_clause, fbod), POOL_NODE},
+};
+
+static const AstField fields_inline_statement[] = {
+    {offsetof(ast_inline_statement, tok), POOL_TOKEN},
+};
+
+static const AstField fields_yield_statement[] = {
+    {offsetof(ast_yield_statement, ref), POOL_NODE},
+};
+
+static const AstField fields_raise_statement[] = {
+    {offsetof(ast_raise_statement, symb), POOL_TOKEN},
+    {offsetof(ast_raise_statement, str), POOL_NODE},
+};
+
+static const AstField fields_start_function[] = {
+    {offsetof(ast_start_function, body), POOL_NODE},
+};
+
+static const AstField fields_import_statement[] = {
+    {offsetof(ast_import_statement, name), POOL_TOKEN},
+    {offsetof(ast_import_statement, mod), POOL_TOKEN},
+    {offsetof(ast_import_statement, module), POOL_NODE},
+    {offsetof(ast_import_statement, cached), POOL_BOOL},
+};
+
+static const AstField fields_expr_binary[] = {
+    {offsetof(ast_expr_binary, oper), POOL_TOKEN},
+    {offsetof(ast_expr_binary, lhs), POOL_NODE},
+    {offsetof(ast_expr_binary, rhs), POOL_NODE},
+};
+
+static const AstField fields_expr_unary[] = {
+    {offsetof(ast_expr_unary, oper), POOL_TOKEN},
+    {offsetof(ast_expr_unary, operand), POOL_NODE},
+};
+
+static const AstField fields_cast_statement[] = {
+    {offsetof(ast_cast_statement, type), POOL_NODE},
+    {offsetof(ast_cast_statement, expr), POOL_NODE},
+};
+
+static const AstField fields_type_name_list[] = {
+    {offsetof(ast_type_name_list, list), POOL_LIST},
+};
+
+static const AstField fields_function_assignment[] = {
+    {offsetof(ast_function_assignment, name), POOL_NODE},
+    {offsetof(ast_function_assignment, inp), POOL_NODE},
+    {offsetof(ast_function_assignment, outp), POOL_NODE},
+};
+
+static const AstField fields_compound_name_list[] = {
+    {offsetof(ast_compound_name_list, list), POOL_LIST},
+};
+
+static const AstField fields_array_param_list[] = {
+    {offsetof(ast_array_param_list, list), POOL_LIST},
+};
+
+static const AstField fields_class_var_declaration[] = {
+    {offsetof(ast_class_var_declaration, var), POOL_NODE},
+};
+
+static const AstField fields_print_statement[] = {
+    {offsetof(ast_print_statement, elist), POOL_NODE},
+};
+
+static const AstField fields_trace_statement[] = {
+    {offsetof(ast_trace_statement, str), POOL_NODE},
+};
+
+static const AstField fields_exit_statement[] = {
+    {offsetof(ast_exit_statement, expr), POOL_NODE},
+};
+
+const AstSchema ast_schema[AST_LAST - AST_FIRST] = {
+    [AST_module - AST_FIRST] = {"module", sizeof(ast_module), 1, fields_module},
+    [AST_module_item - AST_FIRST] = {"module_item", sizeof(ast_module_item), 2, fields_module_item},
+    [AST_namespace_item - AST_FIRST] = {"namespace_item", sizeof(ast_namespace_item), 2, fields_namespace_item},
+    [AST_namespace_definition - AST_FIRST] = {"namespace_definition", sizeof(ast_namespace_definition), 4, fields_namespace_definition},
+    [AST_class_item - AST_FIRST] = {"class_item", sizeof(ast_class_item), 2, fields_class_item},
+    [AST_class_definition - AST_FIRST] = {"class_definition", sizeof(ast_class_definition), 5, fields_class_definition},
+    [AST_compound_name - AST_FIRST] = {"compound_name", sizeof(ast_compound_name), 2, fields_compound_name},
+    [AST_compound_ref_item - AST_FIRST] = {"compound_ref_item", sizeof(ast_compound_ref_item), 2, fields_compound_ref_item},
+    [AST_compound_reference - AST_FIRST] = {"compound_reference", sizeof(ast_compound_reference), 1, fields_compound_reference},
+    [AST_scope_operator - AST_FIRST] = {"scope_operator", sizeof(ast_scope_operator), 1, fields_scope_operator},
+    [AST_literal_type_name - AST_FIRST] = {"literal_type_name", sizeof(ast_literal_type_name), 1, fields_literal_type_name},
+    [AST_literal_value - AST_FIRST] = {"literal_value", sizeof(ast_literal_value), 3, fields_literal_value},
+    [AST_type_name - AST_FIRST] = {"type_name", sizeof(ast_type_name), 1, fields_type_name},
+    [AST_formatted_strg - AST_FIRST] = {"formatted_strg", sizeof(ast_formatted_strg), 2, fields_formatted_strg},
+    [AST_string_literal - AST_FIRST] = {"string_literal", sizeof(ast_string_literal), 2, fields_string_literal},
+    [AST_var_decl - AST_FIRST] = {"var_decl", sizeof(ast_var_decl), 4, fields_var_decl},
+    [AST_var_decl_list - AST_FIRST] = {"var_decl_list", sizeof(ast_var_decl_list), 1, fields_var_decl_list},
+    [AST_var_definition - AST_FIRST] = {"var_definition", sizeof(ast_var_definition), 3, fields_var_definition},
+    [AST_list_init - AST_FIRST] = {"list_init", sizeof(ast_list_init), 1, fields_list_init},
+    [AST_dict_init_element - AST_FIRST] = {"dict_init_element", sizeof(ast_dict_init_element), 2, fields_dict_init_element},
+    [AST_dict_init - AST_FIRST] = {"dict_init", sizeof(ast_dict_init), 1, fields_dict_init},
+    [AST_array_param - AST_FIRST] = {"array_param", sizeof(ast_array_param), 1, fields_array_param},
+    [AST_array_reference - AST_FIRST] = {"array_reference", sizeof(ast_array_reference), 2, fields_array_reference},
+    [AST_function_reference - AST_FIRST] = {"function_reference", sizeof(ast_function_reference), 3, fields_function_reference},
+    [AST_create_reference - AST_FIRST] = {"create_reference", sizeof(ast_create_reference), 2, fields_create_reference},
+    [AST_destroy_reference - AST_FIRST] = {"destroy_reference", sizeof(ast_destroy_reference), 1, fields_destroy_reference},
+    [AST_function_declaration - AST_FIRST] = {"function_declaration", sizeof(ast_function_declaration), 4, fields_function_declaration},
+    [AST_create_declaration - AST_FIRST] = {"create_declaration", sizeof(ast_create_declaration), 2, fields_create_declaration},
+    [AST_destroy_declaration - AST_FIRST] = {"destroy_declaration", sizeof(ast_destroy_declaration), 1, fields_destroy_declaration},
+    [AST_function_definition - AST_FIRST] = {"function_definition", sizeof(ast_function_definition), 5, fields_function_definition},
+    [AST_create_name - AST_FIRST] = {"create_name", sizeof(ast_create_name), 1, fields_create_name},
+    [AST_destroy_name - AST_FIRST] = {"destroy_name", sizeof(ast_destroy_name), 1, fields_destroy_name},
+    [AST_create_definition - AST_FIRST] = {"create_definition", sizeof(ast_create_definition), 4, fields_create_definition},
+    [AST_destroy_definition - AST_FIRST] = {"destroy_definition", sizeof(ast_destroy_definition), 3, fields_destroy_definition},
+    [AST_function_body - AST_FIRST] = {"function_body", sizeof(ast_function_body), 4, fields_function_body},
+    [AST_function_body_element - AST_FIRST] = {"function_body_element", sizeof(ast_function_body_element), 1, fields_function_body_element},
+    [AST_expression - AST_FIRST] = {"expression", sizeof(ast_expression), 3, fields_expression},
+    [AST_expr_primary - AST_FIRST] = {"expr_primary", sizeof(ast_expr_primary), 1, fields_expr_primary},
+    [AST_expression_list - AST_FIRST] = {"expression_list", sizeof(ast_expression_list), 1, fields_expression_list},
+    [AST_assignment_item - AST_FIRST] = {"assignment_item", sizeof(ast_assignment_item), 1, fields_assignment_item},
+    [AST_assignment - AST_FIRST] = {"assignment", sizeof(ast_assignment), 3, fields_assignment},
+    [AST_while_definition - AST_FIRST] = {"while_definition", sizeof(ast_while_definition), 1, fields_while_definition},
+    [AST_while_clause - AST_FIRST] = {"while_clause", sizeof(ast_while_clause), 2, fields_while_clause},
+    [AST_do_clause - AST_FIRST] = {"do_clause", sizeof(ast_do_clause), 2, fields_do_clause},
+    [AST_for_clause - AST_FIRST] = {"for_clause", sizeof(ast_for_clause), 4, fields_for_clause},
+    [AST_if_clause - AST_FIRST] = {"if_clause", sizeof(ast_if_clause), 4, fields_if_clause},
+    [AST_else_clause - AST_FIRST] = {"else_clause", sizeof(ast_else_clause), 1, fields_else_clause},
+    [AST_elif_clause - AST_FIRST] = {"elif_clause", sizeof(ast_elif_clause), 2, fields_elif_clause},
+    [AST_try_clause - AST_FIRST] = {"try_clause", sizeof(ast_try_clause), 3, fields_try_clause},
+    [AST_except_clause - AST_FIRST] = {"except_clause", sizeof(ast_except_clause), 3, fields_except_clause},
+    [AST_final_clause - AST_FIRST] = {"final_clause", sizeof(ast_final_clause), 2, fields_final_clause},
+    [AST_break_statement - AST_FIRST] = {"break_statement", sizeof(ast_break_statement), 0, NULL},
+    [AST_continue_statement - AST_FIRST] = {"continue_statement", sizeof(ast_continue_statement), 0, NULL},
+    [AST_inline_statement - AST_FIRST] = {"inline_statement", sizeof(ast_inline_statement), 1, fields_inline_statement},
+    [AST_yield_statement - AST_FIRST] = {"yield_statement", sizeof(ast_yield_statement), 1, fields_yield_statement},
+    [AST_return_statement - AST_FIRST] = {"return_statement", sizeof(ast_return_statement), 0, NULL},
+    [AST_raise_statement - AST_FIRST] = {"raise_statement", sizeof(ast_raise_statement), 2, fields_raise_statement},
+    [AST_start_function - AST_FIRST] = {"start_function", sizeof(ast_start_function), 1, fields_start_function},
+    [AST_import_statement - AST_FIRST] = {"import_statement", sizeof(ast_import_statement), 4, fields_import_statement},
+    [AST_expr_binary - AST_FIRST] = {"expr_binary", sizeof(ast_expr_binary), 3, fields_expr_binary},
+    [AST_expr_unary - AST_FIRST] = {"expr_unary", sizeof(ast_expr_unary), 2, fields_expr_unary},
+    [AST_cast_statement - AST_FIRST] = {"cast_statement", sizeof(ast_cast_statement), 2, fields_cast_statement},
+    [AST_case_item - AST_FIRST] = {"case_item", 0, 0, NULL},
+    [AST_type_name_list - AST_FIRST] = {"type_name_list", sizeof(ast_type_name_list), 1, fields_type_name_list},
+    [AST_function_assignment - AST_FIRST] = {"function_assignment", sizeof(ast_function_assignment), 3, fields_function_assignment},
+    [AST_compound_name_list - AST_FIRST] = {"compound_name_list", sizeof(ast_compound_name_list), 1, fields_compound_name_list},
+    [AST_array_param_list - AST_FIRST] = {"array_param_list", sizeof(ast_array_param_list), 1, fields_array_param_list},
+    [AST_class_var_declaration - AST_FIRST] = {"class_var_declaration", sizeof(ast_class_var_declaration), 1, fields_class_var_declaration},
+    [AST_print_statement - AST_FIRST] = {"print_statement", sizeof(ast_print_statement), 1, fields_print_statement},
+    [AST_trace_statement - AST_FIRST] = {"trace_statement", sizeof(ast_trace_statement), 1, fields_trace_statement},
+    [AST_exit_statement - AST_FIRST] = {"exit_statement", sizeof(ast_exit_statement), 1, fields_exit_statement},
+};
+
+const uint32_t ast_schema_hash = 0xc4b55ac4;
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/errors.c" "src/common/CMakeFiles/common.dir/errors.c.o" "gcc" "src/common/CMakeFiles/common.dir/errors.c.o.d"
+  "/root/repo/src/common/hash.c" "src/common/CMakeFiles/common.dir/hash.c.o" "gcc" "src/common/CMakeFiles/common.dir/hash.c.o.d"
+  "/root/repo/src/common/intern.c" "src/common/CMakeFiles/common.dir/intern.c.o" "gcc" "src/common/CMakeFiles/common.dir/intern.c.o.d"
+  "/root/repo/src/common/link_list.c" "src/common/CMakeFiles/common.dir/link_list.c.o" "gcc" "src/common/CMakeFiles/common.dir/link_list.c.o.d"
+  "/root/repo/src/common/memory.c" "src/common/CMakeFiles/common.dir/memory.c.o" "gcc" "src/common/CMakeFiles/common.dir/memory.c.o.d"
+  "/root/repo/src/common/paths.c" "src/common/CMakeFiles/common.dir/paths.c.o" "gcc" "src/common/CMakeFiles/common.dir/paths.c.o.d"
+  "/root/repo/src/common/sstrings.c" "src/common/CMakeFiles/common.dir/sstrings.c.o" "gcc" "src/common/CMakeFiles/common.dir/sstrings.c.o.d"
+  "/root/repo/src/common/trace.c" "src/common/CMakeFiles/common.dir/trace.c.o" "gcc" "src/common/CMakeFiles/common.dir/trace.c.o.d"
+  "/root/repo/src/common/uuid.c" "src/common/CMakeFiles/common.dir/uuid.c.o" "gcc" "src/common/CMakeFiles/common.dir/uuid.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libcommon.a"
+  "/root/repo/lib/libcommon.pdb"
+  "CMakeFiles/common.dir/errors.c.o"
+  "CMakeFiles/common.dir/errors.c.o.d"
+  "CMakeFiles/common.dir/hash.c.o"
+  "CMakeFiles/common.dir/hash.c.o.d"
+  "CMakeFiles/common.dir/intern.c.o"
+  "CMakeFiles/common.dir/intern.c.o.d"
+  "CMakeFiles/common.dir/link_list.c.o"
+  "CMakeFiles/common.dir/link_list.c.o.d"
+  "CMakeFiles/common.dir/memory.c.o"
+  "CMakeFiles/common.dir/memory.c.o.d"
+  "CMakeFiles/common.dir/paths.c.o"
+  "CMakeFiles/common.dir/paths.c.o.d"
+  "CMakeFiles/common.dir/sstrings.c.o"
+  "CMakeFiles/common.dir/sstrings.c.o.d"
+  "CMakeFiles/common.dir/trace.c.o"
+  "CMakeFiles/common.dir/trace.c.o.d"
+  "CMakeFiles/common.dir/uuid.c.o"
+  "CMakeFiles/common.dir/uuid.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/kata"
+  "/root/repo/bin/kata.pdb"
+  "CMakeFiles/kata.dir/command_line.c.o"
+  "CMakeFiles/kata.dir/command_line.c.o.d"
+  "CMakeFiles/kata.dir/kata.c.o"
+  "CMakeFiles/kata.dir/kata.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/kata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/parse/compound.c" "src/parse/CMakeFiles/parse.dir/compound.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/compound.c.o.d"
+  "/root/repo/src/parse/except.c" "src/parse/CMakeFiles/parse.dir/except.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/except.c.o.d"
+  "/root/repo/src/parse/expr.c" "src/parse/CMakeFiles/parse.dir/expr.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/expr.c.o.d"
+  "/root/repo/build/src/parse/first_sets.c" "src/parse/CMakeFiles/parse.dir/first_sets.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/first_sets.c.o.d"
+  "/root/repo/src/parse/flow.c" "src/parse/CMakeFiles/parse.dir/flow.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/flow.c.o.d"
+  "/root/repo/src/parse/func.c" "src/parse/CMakeFiles/parse.dir/func.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/func.c.o.d"
+  "/root/repo/src/parse/func_body.c" "src/parse/CMakeFiles/parse.dir/func_body.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/func_body.c.o.d"
+  "/root/repo/src/parse/import.c" "src/parse/CMakeFiles/parse.dir/import.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/import.c.o.d"
+  "/root/repo/src/parse/import_jobs.c" "src/parse/CMakeFiles/parse.dir/import_jobs.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/import_jobs.c.o.d"
+  "/root/repo/src/parse/interface.c" "src/parse/CMakeFiles/parse.dir/interface.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/interface.c.o.d"
+  "/root/repo/src/parse/lazy.c" "src/parse/CMakeFiles/parse.dir/lazy.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/lazy.c.o.d"
+  "/root/repo/src/parse/list.c" "src/parse/CMakeFiles/parse.dir/list.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/list.c.o.d"
+  "/root/repo/src/parse/literals.c" "src/parse/CMakeFiles/parse.dir/literals.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/literals.c.o.d"
+  "/root/repo/src/parse/loop.c" "src/parse/CMakeFiles/parse.dir/loop.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/loop.c.o.d"
+  "/root/repo/src/parse/memo.c" "src/parse/CMakeFiles/parse.dir/memo.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/memo.c.o.d"
+  "/root/repo/src/parse/module.c" "src/parse/CMakeFiles/parse.dir/module.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/module.c.o.d"
+  "/root/repo/src/parse/parse.c" "src/parse/CMakeFiles/parse.dir/parse.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/parse.c.o.d"
+  "/root/repo/src/parse/parse_state.c" "src/parse/CMakeFiles/parse.dir/parse_state.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/parse_state.c.o.d"
+  "/root/repo/src/parse/parse_stats.c" "src/parse/CMakeFiles/parse.dir/parse_stats.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/parse_stats.c.o.d"
+  "/root/repo/src/parse/strg.c" "src/parse/CMakeFiles/parse.dir/strg.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/strg.c.o.d"
+  "/root/repo/src/parse/vars.c" "src/parse/CMakeFiles/parse.dir/vars.c.o" "gcc" "src/parse/CMakeFiles/parse.dir/vars.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/src/parse/first_sets.h" "/root/repo/build/src/parse/first_sets.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
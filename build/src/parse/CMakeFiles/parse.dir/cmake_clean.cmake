@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libparse.a"
+  "/root/repo/lib/libparse.pdb"
+  "CMakeFiles/parse.dir/compound.c.o"
+  "CMakeFiles/parse.dir/compound.c.o.d"
+  "CMakeFiles/parse.dir/except.c.o"
+  "CMakeFiles/parse.dir/except.c.o.d"
+  "CMakeFiles/parse.dir/expr.c.o"
+  "CMakeFiles/parse.dir/expr.c.o.d"
+  "CMakeFiles/parse.dir/first_sets.c.o"
+  "CMakeFiles/parse.dir/first_sets.c.o.d"
+  "CMakeFiles/parse.dir/flow.c.o"
+  "CMakeFiles/parse.dir/flow.c.o.d"
+  "CMakeFiles/parse.dir/func.c.o"
+  "CMakeFiles/parse.dir/func.c.o.d"
+  "CMakeFiles/parse.dir/func_body.c.o"
+  "CMakeFiles/parse.dir/func_body.c.o.d"
+  "CMakeFiles/parse.dir/import.c.o"
+  "CMakeFiles/parse.dir/import.c.o.d"
+  "CMakeFiles/parse.dir/import_jobs.c.o"
+  "CMakeFiles/parse.dir/import_jobs.c.o.d"
+  "CMakeFiles/parse.dir/interface.c.o"
+  "CMakeFiles/parse.dir/interface.c.o.d"
+  "CMakeFiles/parse.dir/lazy.c.o"
+  "CMakeFiles/parse.dir/lazy.c.o.d"
+  "CMakeFiles/parse.dir/list.c.o"
+  "CMakeFiles/parse.dir/list.c.o.d"
+  "CMakeFiles/parse.dir/literals.c.o"
+  "CMakeFiles/parse.dir/literals.c.o.d"
+  "CMakeFiles/parse.dir/loop.c.o"
+  "CMakeFiles/parse.dir/loop.c.o.d"
+  "CMakeFiles/parse.dir/memo.c.o"
+  "CMakeFiles/parse.dir/memo.c.o.d"
+  "CMakeFiles/parse.dir/module.c.o"
+  "CMakeFiles/parse.dir/module.c.o.d"
+  "CMakeFiles/parse.dir/parse.c.o"
+  "CMakeFiles/parse.dir/parse.c.o.d"
+  "CMakeFiles/parse.dir/parse_state.c.o"
+  "CMakeFiles/parse.dir/parse_state.c.o.d"
+  "CMakeFiles/parse.dir/parse_stats.c.o"
+  "CMakeFiles/parse.dir/parse_stats.c.o.d"
+  "CMakeFiles/parse.dir/strg.c.o"
+  "CMakeFiles/parse.dir/strg.c.o.d"
+  "CMakeFiles/parse.dir/vars.c.o"
+  "CMakeFiles/parse.dir/vars.c.o.d"
+  "first_sets.c"
+  "first_sets.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/parse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,264 @@
+/* This file is generated with a script. Do not edit. */
+#include "first_sets.h"
+
+_Static_assert(TOK_UNARY_MINUS == 91, "the token list changed");
+
+const uint32_t first_sets[FIRST_NUM_RULES][FIRST_WORDS] = {
+    // module
+    // TOK_CLASS TOK_FUNC TOK_FUNCTION TOK_IMPORT TOK_NAMESPACE TOK_PRIVATE
+    // TOK_PROTECTED TOK_PUBLIC TOK_VAR TOK_VARIABLE
+    [FIRST_module] = { 0x45800100, 0x001800E0, 0x00000000 },
+    // module_item
+    // TOK_CLASS TOK_FUNC TOK_FUNCTION TOK_IMPORT TOK_NAMESPACE TOK_PRIVATE
+    // TOK_PROTECTED TOK_PUBLIC TOK_VAR TOK_VARIABLE
+    [FIRST_module_item] = { 0x45800100, 0x001800E0, 0x00000000 },
+    // start_function
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_start_function] = { 0x01800000, 0x00000000, 0x00000000 },
+    // import_statement
+    // TOK_IMPORT
+    [FIRST_import_statement] = { 0x04000000, 0x00000000, 0x00000000 },
+    // namespace_item
+    // TOK_CLASS TOK_FUNC TOK_FUNCTION TOK_NAMESPACE TOK_PRIVATE TOK_PROTECTED
+    // TOK_PUBLIC TOK_VAR TOK_VARIABLE
+    [FIRST_namespace_item] = { 0x41800100, 0x001800E0, 0x00000000 },
+    // scope_operator
+    // TOK_PRIVATE TOK_PROTECTED TOK_PUBLIC
+    [FIRST_scope_operator] = { 0x00000000, 0x000000E0, 0x00000000 },
+    // literal_type_name
+    // TOK_BOOLEAN TOK_DICT TOK_FLOAT TOK_FUNCTION TOK_LIST TOK_NOTHING
+    // TOK_SIGNED TOK_STRING TOK_UNSIGNED
+    [FIRST_literal_type_name] = { 0x21202040, 0x00041401, 0x00000000 },
+    // type_name
+    // TOK_BOOLEAN TOK_DICT TOK_FLOAT TOK_FUNCTION TOK_LIST TOK_NOTHING
+    // TOK_SIGNED TOK_STRING TOK_UNSIGNED TOK_SYMBOL
+    [FIRST_type_name] = { 0x21202040, 0x00041401, 0x02000000 },
+    // type_name_list
+    // TOK_OPAREN
+    [FIRST_type_name_list] = { 0x00000000, 0x00000000, 0x00000080 },
+    // formatted_strg
+    // TOK_LITERAL_DSTR
+    [FIRST_formatted_strg] = { 0x00000000, 0x00000000, 0x00800000 },
+    // string_literal
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR
+    [FIRST_string_literal] = { 0x00000000, 0x00000000, 0x01800000 },
+    // literal_value
+    // TOK_FALSE TOK_OFF TOK_ON TOK_TRUE TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED
+    // TOK_LITERAL_UNSIGNED TOK_LITERAL_DSTR TOK_LITERAL_SSTR
+    [FIRST_literal_value] = { 0x00080000, 0x00008006, 0x01F00000 },
+    // var_decl
+    // TOK_BOOLEAN TOK_CONST TOK_DICT TOK_FLOAT TOK_FUNCTION TOK_LIST
+    // TOK_NOTHING TOK_SIGNED TOK_STRING TOK_UNSIGNED TOK_SYMBOL
+    [FIRST_var_decl] = { 0x21202240, 0x00041401, 0x02000000 },
+    // var_decl_list
+    // TOK_OPAREN
+    [FIRST_var_decl_list] = { 0x00000000, 0x00000000, 0x00000080 },
+    // function_assignment
+    // TOK_SYMBOL
+    [FIRST_function_assignment] = { 0x00000000, 0x00000000, 0x02000000 },
+    // assignment_item
+    // TOK_BOOLEAN TOK_DICT TOK_FALSE TOK_FLOAT TOK_FUNCTION TOK_LIST TOK_NOT
+    // TOK_NOTHING TOK_OFF TOK_ON TOK_SIGNED TOK_STRING TOK_TRUE TOK_UNSIGNED
+    // TOK_SUB TOK_OPAREN TOK_OSBRACE TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED
+    // TOK_LITERAL_UNSIGNED TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_assignment_item] = { 0xA1282040, 0x00049407, 0x03F00884 },
+    // var_definition
+    // TOK_VAR TOK_VARIABLE
+    [FIRST_var_definition] = { 0x00000000, 0x00180000, 0x00000000 },
+    // dict_init_element
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR
+    [FIRST_dict_init_element] = { 0x00000000, 0x00000000, 0x01800000 },
+    // list_init
+    // TOK_OSBRACE
+    [FIRST_list_init] = { 0x00000000, 0x00000000, 0x00000800 },
+    // array_param
+    // TOK_OSBRACE
+    [FIRST_array_param] = { 0x00000000, 0x00000000, 0x00000800 },
+    // array_param_list
+    // TOK_OSBRACE
+    [FIRST_array_param_list] = { 0x00000000, 0x00000000, 0x00000800 },
+    // array_reference
+    // TOK_SYMBOL
+    [FIRST_array_reference] = { 0x00000000, 0x00000000, 0x02000000 },
+    // function_reference
+    // TOK_SYMBOL
+    [FIRST_function_reference] = { 0x00000000, 0x00000000, 0x02000000 },
+    // create_reference
+    // TOK_SYMBOL
+    [FIRST_create_reference] = { 0x00000000, 0x00000000, 0x02000000 },
+    // destroy_reference
+    // TOK_SYMBOL
+    [FIRST_destroy_reference] = { 0x00000000, 0x00000000, 0x02000000 },
+    // compound_name
+    // TOK_SYMBOL
+    [FIRST_compound_name] = { 0x00000000, 0x00000000, 0x02000000 },
+    // compound_name_list
+    // TOK_OPAREN
+    [FIRST_compound_name_list] = { 0x00000000, 0x00000000, 0x00000080 },
+    // compound_ref_item
+    // TOK_SYMBOL
+    [FIRST_compound_ref_item] = { 0x00000000, 0x00000000, 0x02000000 },
+    // compound_reference
+    // TOK_SYMBOL
+    [FIRST_compound_reference] = { 0x00000000, 0x00000000, 0x02000000 },
+    // expression
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expression] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_and
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_and] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_equ
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_equ] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_mag
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_mag] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_term
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_term] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_fact
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_fact] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_pow
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_pow] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // expr_unary
+    // TOK_FALSE TOK_NOT TOK_OFF TOK_ON TOK_TRUE TOK_SUB TOK_OPAREN
+    // TOK_LITERAL_FLOAT TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED
+    // TOK_LITERAL_DSTR TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_unary] = { 0x80080000, 0x00008006, 0x03F00084 },
+    // cast_statement
+    // TOK_BOOLEAN TOK_DICT TOK_FLOAT TOK_FUNCTION TOK_LIST TOK_NOTHING
+    // TOK_SIGNED TOK_STRING TOK_UNSIGNED TOK_SYMBOL
+    [FIRST_cast_statement] = { 0x21202040, 0x00041401, 0x02000000 },
+    // expr_primary
+    // TOK_FALSE TOK_OFF TOK_ON TOK_TRUE TOK_OPAREN TOK_LITERAL_FLOAT
+    // TOK_LITERAL_SIGNED TOK_LITERAL_UNSIGNED TOK_LITERAL_DSTR
+    // TOK_LITERAL_SSTR TOK_SYMBOL
+    [FIRST_expr_primary] = { 0x00080000, 0x00008006, 0x03F00080 },
+    // expression_list
+    // TOK_OPAREN
+    [FIRST_expression_list] = { 0x00000000, 0x00000000, 0x00000080 },
+    // namespace_definition
+    // TOK_NAMESPACE
+    [FIRST_namespace_definition] = { 0x40000000, 0x00000000, 0x00000000 },
+    // class_definition
+    // TOK_CLASS
+    [FIRST_class_definition] = { 0x00000100, 0x00000000, 0x00000000 },
+    // class_item
+    // TOK_FUNC TOK_FUNCTION TOK_PRIVATE TOK_PROTECTED TOK_PUBLIC TOK_VAR
+    // TOK_VARIABLE
+    [FIRST_class_item] = { 0x01800000, 0x001800E0, 0x00000000 },
+    // class_var_declaration
+    // TOK_VAR TOK_VARIABLE
+    [FIRST_class_var_declaration] = { 0x00000000, 0x00180000, 0x00000000 },
+    // function_declaration
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_function_declaration] = { 0x01800000, 0x00000000, 0x00000000 },
+    // create_declaration
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_create_declaration] = { 0x01800000, 0x00000000, 0x00000000 },
+    // destroy_declaration
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_destroy_declaration] = { 0x01800000, 0x00000000, 0x00000000 },
+    // function_definition
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_function_definition] = { 0x01800000, 0x00000000, 0x00000000 },
+    // create_name
+    // TOK_SYMBOL
+    [FIRST_create_name] = { 0x00000000, 0x00000000, 0x02000000 },
+    // create_definition
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_create_definition] = { 0x01800000, 0x00000000, 0x00000000 },
+    // destroy_name
+    // TOK_SYMBOL
+    [FIRST_destroy_name] = { 0x00000000, 0x00000000, 0x02000000 },
+    // destroy_definition
+    // TOK_FUNC TOK_FUNCTION
+    [FIRST_destroy_definition] = { 0x01800000, 0x00000000, 0x00000000 },
+    // function_body
+    // TOK_OCBRACE
+    [FIRST_function_body] = { 0x00000000, 0x00000000, 0x00000200 },
+    // assignment
+    // TOK_SYMBOL
+    [FIRST_assignment] = { 0x00000000, 0x00000000, 0x02000000 },
+    // function_body_element
+    // TOK_BREAK TOK_CONTINUE TOK_DO TOK_EXIT TOK_FOR TOK_IF TOK_INLINE
+    // TOK_PRINT TOK_RAISE TOK_RETURN TOK_TRACE TOK_TRY TOK_TYPE TOK_VAR
+    // TOK_VARIABLE TOK_WHILE TOK_YIELD TOK_OCBRACE TOK_SYMBOL
+    [FIRST_function_body_element] = { 0x12444480, 0x00DB4310, 0x02000200 },
+    // break_statement
+    // TOK_BREAK
+    [FIRST_break_statement] = { 0x00000080, 0x00000000, 0x00000000 },
+    // continue_statement
+    // TOK_CONTINUE
+    [FIRST_continue_statement] = { 0x00000400, 0x00000000, 0x00000000 },
+    // inline_statement
+    // TOK_INLINE
+    [FIRST_inline_statement] = { 0x10000000, 0x00000000, 0x00000000 },
+    // yield_statement
+    // TOK_YIELD
+    [FIRST_yield_statement] = { 0x00000000, 0x00800000, 0x00000000 },
+    // type_statement
+    // TOK_TYPE
+    [FIRST_type_statement] = { 0x00000000, 0x00020000, 0x00000000 },
+    // return_statement
+    // TOK_RETURN
+    [FIRST_return_statement] = { 0x00000000, 0x00000200, 0x00000000 },
+    // raise_statement
+    // TOK_RAISE
+    [FIRST_raise_statement] = { 0x00000000, 0x00000100, 0x00000000 },
+    // trace_statement
+    // TOK_TRACE
+    [FIRST_trace_statement] = { 0x00000000, 0x00004000, 0x00000000 },
+    // print_statement
+    // TOK_PRINT
+    [FIRST_print_statement] = { 0x00000000, 0x00000010, 0x00000000 },
+    // exit_statement
+    // TOK_EXIT
+    [FIRST_exit_statement] = { 0x00040000, 0x00000000, 0x00000000 },
+    // while_definition
+    // TOK_WHILE
+    [FIRST_while_definition] = { 0x00000000, 0x00400000, 0x00000000 },
+    // while_clause
+    // TOK_WHILE
+    [FIRST_while_clause] = { 0x00000000, 0x00400000, 0x00000000 },
+    // do_clause
+    // TOK_DO
+    [FIRST_do_clause] = { 0x00004000, 0x00000000, 0x00000000 },
+    // for_clause
+    // TOK_FOR
+    [FIRST_for_clause] = { 0x00400000, 0x00000000, 0x00000000 },
+    // if_clause
+    // TOK_IF
+    [FIRST_if_clause] = { 0x02000000, 0x00000000, 0x00000000 },
+    // elif_clause
+    // TOK_ELIF
+    [FIRST_elif_clause] = { 0x00008000, 0x00000000, 0x00000000 },
+    // else_clause
+    // TOK_ELSE
+    [FIRST_else_clause] = { 0x00010000, 0x00000000, 0x00000000 },
+    // try_clause
+    // TOK_TRY
+    [FIRST_try_clause] = { 0x00000000, 0x00010000, 0x00000000 },
+    // except_clause
+    // TOK_EXCEPT
+    [FIRST_except_clause] = { 0x00020000, 0x00000000, 0x00000000 },
+    // final_clause
+    // TOK_FINAL
+    [FIRST_final_clause] = { 0x00100000, 0x00000000, 0x00000000 },
+};
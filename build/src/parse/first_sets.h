@@ -0,0 +1,101 @@
+/* This file is generated with a script. Do not edit. */
+#ifndef _FIRST_SETS_H_
+#define _FIRST_SETS_H_
+#include <stdbool.h>
+#include <stdint.h>
+#include "tokens.h"
+
+typedef enum {
+    FIRST_module,
+    FIRST_module_item,
+    FIRST_start_function,
+    FIRST_import_statement,
+    FIRST_namespace_item,
+    FIRST_scope_operator,
+    FIRST_literal_type_name,
+    FIRST_type_name,
+    FIRST_type_name_list,
+    FIRST_formatted_strg,
+    FIRST_string_literal,
+    FIRST_literal_value,
+    FIRST_var_decl,
+    FIRST_var_decl_list,
+    FIRST_function_assignment,
+    FIRST_assignment_item,
+    FIRST_var_definition,
+    FIRST_dict_init_element,
+    FIRST_list_init,
+    FIRST_array_param,
+    FIRST_array_param_list,
+    FIRST_array_reference,
+    FIRST_function_reference,
+    FIRST_create_reference,
+    FIRST_destroy_reference,
+    FIRST_compound_name,
+    FIRST_compound_name_list,
+    FIRST_compound_ref_item,
+    FIRST_compound_reference,
+    FIRST_expression,
+    FIRST_expr_and,
+    FIRST_expr_equ,
+    FIRST_expr_mag,
+    FIRST_expr_term,
+    FIRST_expr_fact,
+    FIRST_expr_pow,
+    FIRST_expr_unary,
+    FIRST_cast_statement,
+    FIRST_expr_primary,
+    FIRST_expression_list,
+    FIRST_namespace_definition,
+    FIRST_class_definition,
+    FIRST_class_item,
+    FIRST_class_var_declaration,
+    FIRST_function_declaration,
+    FIRST_create_declaration,
+    FIRST_destroy_declaration,
+    FIRST_function_definition,
+    FIRST_create_name,
+    FIRST_create_definition,
+    FIRST_destroy_name,
+    FIRST_destroy_definition,
+    FIRST_function_body,
+    FIRST_assignment,
+    FIRST_function_body_element,
+    FIRST_break_statement,
+    FIRST_continue_statement,
+    FIRST_inline_statement,
+    FIRST_yield_statement,
+    FIRST_type_statement,
+    FIRST_return_statement,
+    FIRST_raise_statement,
+    FIRST_trace_statement,
+    FIRST_print_statement,
+    FIRST_exit_statement,
+    FIRST_while_definition,
+    FIRST_while_clause,
+    FIRST_do_clause,
+    FIRST_for_clause,
+    FIRST_if_clause,
+    FIRST_elif_clause,
+    FIRST_else_clause,
+    FIRST_try_clause,
+    FIRST_except_clause,
+    FIRST_final_clause,
+    FIRST_NUM_RULES,
+} FirstRule;
+
+#define FIRST_WORDS 3
+
+extern const uint32_t first_sets[FIRST_NUM_RULES][FIRST_WORDS];
+
+/*
+ * Return true if the rule can start with the token, or can match nothing
+ * and return when it sees the token.
+ */
+static inline bool in_first_set(FirstRule rule, TokenType type) {
+    return (first_sets[rule][type >> 5] >> (type & 31)) & 0x01;
+}
+
+#define CAN_START(rule) (in_first_set(FIRST_##rule, TTYPE))
+
+#endif /* _FIRST_SETS_H_ */
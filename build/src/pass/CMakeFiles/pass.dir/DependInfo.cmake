@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/pass/bodypass.c" "src/pass/CMakeFiles/pass.dir/bodypass.c.o" "gcc" "src/pass/CMakeFiles/pass.dir/bodypass.c.o.d"
+  "/root/repo/src/pass/passes.c" "src/pass/CMakeFiles/pass.dir/passes.c.o" "gcc" "src/pass/CMakeFiles/pass.dir/passes.c.o.d"
+  "/root/repo/src/pass/sympass.c" "src/pass/CMakeFiles/pass.dir/sympass.c.o" "gcc" "src/pass/CMakeFiles/pass.dir/sympass.c.o.d"
+  "/root/repo/src/pass/testpass.c" "src/pass/CMakeFiles/pass.dir/testpass.c.o" "gcc" "src/pass/CMakeFiles/pass.dir/testpass.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libpass.a"
+  "/root/repo/lib/libpass.pdb"
+  "CMakeFiles/pass.dir/bodypass.c.o"
+  "CMakeFiles/pass.dir/bodypass.c.o.d"
+  "CMakeFiles/pass.dir/passes.c.o"
+  "CMakeFiles/pass.dir/passes.c.o.d"
+  "CMakeFiles/pass.dir/sympass.c.o"
+  "CMakeFiles/pass.dir/sympass.c.o.d"
+  "CMakeFiles/pass.dir/testpass.c.o"
+  "CMakeFiles/pass.dir/testpass.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pass.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
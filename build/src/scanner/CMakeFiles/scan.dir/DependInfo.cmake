@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/scanner/fastscan.c" "src/scanner/CMakeFiles/scan.dir/fastscan.c.o" "gcc" "src/scanner/CMakeFiles/scan.dir/fastscan.c.o.d"
+  "/root/repo/src/scanner/fileio.c" "src/scanner/CMakeFiles/scan.dir/fileio.c.o" "gcc" "src/scanner/CMakeFiles/scan.dir/fileio.c.o.d"
+  "/root/repo/src/scanner/scanner.c" "src/scanner/CMakeFiles/scan.dir/scanner.c.o" "gcc" "src/scanner/CMakeFiles/scan.dir/scanner.c.o.d"
+  "/root/repo/src/scanner/tok_queue.c" "src/scanner/CMakeFiles/scan.dir/tok_queue.c.o" "gcc" "src/scanner/CMakeFiles/scan.dir/tok_queue.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
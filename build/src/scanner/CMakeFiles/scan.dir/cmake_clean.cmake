@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libscan.a"
+  "/root/repo/lib/libscan.pdb"
+  "CMakeFiles/scan.dir/fastscan.c.o"
+  "CMakeFiles/scan.dir/fastscan.c.o.d"
+  "CMakeFiles/scan.dir/fileio.c.o"
+  "CMakeFiles/scan.dir/fileio.c.o.d"
+  "CMakeFiles/scan.dir/scanner.c.o"
+  "CMakeFiles/scan.dir/scanner.c.o.d"
+  "CMakeFiles/scan.dir/tok_queue.c.o"
+  "CMakeFiles/scan.dir/tok_queue.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/scan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/symbols/context.c" "src/symbols/CMakeFiles/symbols.dir/context.c.o" "gcc" "src/symbols/CMakeFiles/symbols.dir/context.c.o.d"
+  "/root/repo/src/symbols/symbols.c" "src/symbols/CMakeFiles/symbols.dir/symbols.c.o" "gcc" "src/symbols/CMakeFiles/symbols.dir/symbols.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libsymbols.a"
+  "/root/repo/lib/libsymbols.pdb"
+  "CMakeFiles/symbols.dir/context.c.o"
+  "CMakeFiles/symbols.dir/context.c.o.d"
+  "CMakeFiles/symbols.dir/symbols.c.o"
+  "CMakeFiles/symbols.dir/symbols.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/symbols.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/lib/libtokens.a"
+  "/root/repo/lib/libtokens.pdb"
+  "CMakeFiles/tokens.dir/tokens.c.o"
+  "CMakeFiles/tokens.dir/tokens.c.o.d"
+  "tokens.c"
+  "tokens.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tokens.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,345 @@
+/* This file is generated with a script. Do not edit. */
+#include <assert.h>
+#include <stddef.h>
+#include <strings.h>
+#include "tokens.h"
+
+/*
+ * Perfect hash parameters found by mk_tokens.py. Every keyword lands in a
+ * different slot of keyword_table[].
+ */
+#define HASH_M0 3u
+#define HASH_M1 8u
+#define HASH_M2 21u
+#define HASH_M3 6u
+#define HASH_SIZE 128u
+#define MIN_KEYWORD_LEN 2
+#define MAX_KEYWORD_LEN 9
+
+#define FOLD(c) ((unsigned)(unsigned char)(c) | 0x20u)
+
+typedef struct {
+    const char* str;
+    int len;
+    TokenType type;
+} KeywordSlot;
+
+KeywordList keyword_list[] = {
+    { "and", TOK_AND },
+    { "any", TOK_ANY },
+    { "as", TOK_AS },
+    { "boolean", TOK_BOOLEAN },
+    { "break", TOK_BREAK },
+    { "class", TOK_CLASS },
+    { "const", TOK_CONST },
+    { "continue", TOK_CONTINUE },
+    { "create", TOK_CREATE },
+    { "destroy", TOK_DESTROY },
+    { "dict", TOK_DICT },
+    { "do", TOK_DO },
+    { "elif", TOK_ELIF },
+    { "else", TOK_ELSE },
+    { "except", TOK_EXCEPT },
+    { "exit", TOK_EXIT },
+    { "false", TOK_FALSE },
+    { "final", TOK_FINAL },
+    { "float", TOK_FLOAT },
+    { "for", TOK_FOR },
+    { "func", TOK_FUNC },
+    { "function", TOK_FUNCTION },
+    { "if", TOK_IF },
+    { "import", TOK_IMPORT },
+    { "in", TOK_IN },
+    { "inline", TOK_INLINE },
+    { "list", TOK_LIST },
+    { "namespace", TOK_NAMESPACE },
+    { "not", TOK_NOT },
+    { "nothing", TOK_NOTHING },
+    { "off", TOK_OFF },
+    { "on", TOK_ON },
+    { "or", TOK_OR },
+    { "print", TOK_PRINT },
+    { "private", TOK_PRIVATE },
+    { "protected", TOK_PROTECTED },
+    { "public", TOK_PUBLIC },
+    { "raise", TOK_RAISE },
+    { "return", TOK_RETURN },
+    { "signed", TOK_SIGNED },
+    { "start", TOK_START },
+    { "string", TOK_STRING },
+    { "struct", TOK_STRUCT },
+    { "trace", TOK_TRACE },
+    { "true", TOK_TRUE },
+    { "try", TOK_TRY },
+    { "type", TOK_TYPE },
+    { "unsigned", TOK_UNSIGNED },
+    { "var", TOK_VAR },
+    { "variable", TOK_VARIABLE },
+    { "virtual", TOK_VIRTUAL },
+    { "while", TOK_WHILE },
+    { "yield", TOK_YIELD },
+};
+
+const int num_keywords = (sizeof(keyword_list) / sizeof(KeywordList));
+
+static const KeywordSlot keyword_table[HASH_SIZE] = {
+    { "for", 3, TOK_FOR },
+    { "else", 4, TOK_ELSE },
+    { "trace", 5, TOK_TRACE },
+    { "dict", 4, TOK_DICT },
+    { "or", 2, TOK_OR },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "signed", 6, TOK_SIGNED },
+    { "exit", 4, TOK_EXIT },
+    { NULL, 0, TOK_SYMBOL },
+    { "unsigned", 8, TOK_UNSIGNED },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "destroy", 7, TOK_DESTROY },
+    { "if", 2, TOK_IF },
+    { NULL, 0, TOK_SYMBOL },
+    { "float", 5, TOK_FLOAT },
+    { "list", 4, TOK_LIST },
+    { "func", 4, TOK_FUNC },
+    { "boolean", 7, TOK_BOOLEAN },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "on", 2, TOK_ON },
+    { NULL, 0, TOK_SYMBOL },
+    { "raise", 5, TOK_RAISE },
+    { "variable", 8, TOK_VARIABLE },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "private", 7, TOK_PRIVATE },
+    { NULL, 0, TOK_SYMBOL },
+    { "true", 4, TOK_TRUE },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "continue", 8, TOK_CONTINUE },
+    { NULL, 0, TOK_SYMBOL },
+    { "import", 6, TOK_IMPORT },
+    { NULL, 0, TOK_SYMBOL },
+    { "as", 2, TOK_AS },
+    { NULL, 0, TOK_SYMBOL },
+    { "string", 6, TOK_STRING },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "elif", 4, TOK_ELIF },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "type", 4, TOK_TYPE },
+    { "except", 6, TOK_EXCEPT },
+    { "protected", 9, TOK_PROTECTED },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "public", 6, TOK_PUBLIC },
+    { NULL, 0, TOK_SYMBOL },
+    { "while", 5, TOK_WHILE },
+    { "off", 3, TOK_OFF },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "not", 3, TOK_NOT },
+    { "final", 5, TOK_FINAL },
+    { "class", 5, TOK_CLASS },
+    { "return", 6, TOK_RETURN },
+    { NULL, 0, TOK_SYMBOL },
+    { "virtual", 7, TOK_VIRTUAL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "start", 5, TOK_START },
+    { "inline", 6, TOK_INLINE },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "namespace", 9, TOK_NAMESPACE },
+    { "try", 3, TOK_TRY },
+    { "var", 3, TOK_VAR },
+    { "do", 2, TOK_DO },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "function", 8, TOK_FUNCTION },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "print", 5, TOK_PRINT },
+    { "const", 5, TOK_CONST },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "in", 2, TOK_IN },
+    { NULL, 0, TOK_SYMBOL },
+    { "break", 5, TOK_BREAK },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "any", 3, TOK_ANY },
+    { NULL, 0, TOK_SYMBOL },
+    { "and", 3, TOK_AND },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+    { "nothing", 7, TOK_NOTHING },
+    { "yield", 5, TOK_YIELD },
+    { "false", 5, TOK_FALSE },
+    { NULL, 0, TOK_SYMBOL },
+    { "struct", 6, TOK_STRUCT },
+    { NULL, 0, TOK_SYMBOL },
+    { "create", 6, TOK_CREATE },
+    { NULL, 0, TOK_SYMBOL },
+    { NULL, 0, TOK_SYMBOL },
+};
+
+static inline unsigned keyword_hash(const char* str, int len) {
+
+    return ((unsigned)len * HASH_M0 + FOLD(str[0]) * HASH_M1 +
+            FOLD(str[len >> 1]) * HASH_M2 + FOLD(str[len - 1]) * HASH_M3) &
+           (HASH_SIZE - 1);
+}
+
+TokenType find_keyword(const char* str, int len) {
+
+    assert(str != NULL);
+
+    if(len < MIN_KEYWORD_LEN || len > MAX_KEYWORD_LEN)
+        return TOK_SYMBOL;
+
+    const KeywordSlot* slot = &keyword_table[keyword_hash(str, len)];
+    if(slot->len == len && !strncasecmp(slot->str, str, len))
+        return slot->type;
+
+    return TOK_SYMBOL;
+}
+
+const char* tok_to_str(Token* tok) {
+    
+    assert(tok != NULL);
+
+    if(TOK_ERROR == tok->type) {
+        return raw_string(tok->str);
+    }
+    else
+        return
+        /* keywords */
+        (tok->type == TOK_BREAK)? "break" :
+        (tok->type == TOK_CONTINUE)? "continue" :
+        (tok->type == TOK_CONST)? "const" :
+        (tok->type == TOK_FINAL)? "final" :
+        (tok->type == TOK_IMPORT)? "import" :
+        (tok->type == TOK_DO)? "do" :
+        (tok->type == TOK_ELSE)? "else" :
+        (tok->type == TOK_ELIF)? "elif" :
+        (tok->type == TOK_FOR)? "for" :
+        (tok->type == TOK_IF)? "if" :
+        (tok->type == TOK_RETURN)? "return" :
+        (tok->type == TOK_WHILE)? "while" :
+        (tok->type == TOK_IN)? "in" :
+        (tok->type == TOK_AS)? "as" :
+        (tok->type == TOK_YIELD)? "yield" :
+        (tok->type == TOK_TRY)? "try" :
+        (tok->type == TOK_EXCEPT)? "except" :
+        (tok->type == TOK_RAISE)? "raise" :
+        (tok->type == TOK_CREATE)? "create" :
+        (tok->type == TOK_DESTROY)? "destroy" :
+        (tok->type == TOK_START)? "start" :
+        (tok->type == TOK_NAMESPACE)? "namespace" :
+        (tok->type == TOK_CLASS)? "class" :
+        (tok->type == TOK_STRUCT)? "struct" :
+        (tok->type == TOK_PUBLIC)? "public" :
+        (tok->type == TOK_PRIVATE)? "private" :
+        (tok->type == TOK_PROTECTED)? "protected" :
+        (tok->type == TOK_NOTHING)? "nothing" :
+        (tok->type == TOK_STRING)? "string" :
+        (tok->type == TOK_BOOLEAN)? "boolean" :
+        (tok->type == TOK_LIST)? "list" :
+        (tok->type == TOK_DICT)? "dict" :
+        (tok->type == TOK_TYPE)? "type" :
+        (tok->type == TOK_TRUE)? "true" :
+        (tok->type == TOK_FALSE)? "false" :
+        (tok->type == TOK_ON)? "on" :
+        (tok->type == TOK_OFF)? "off" :
+        (tok->type == TOK_OR)? "or" :
+        (tok->type == TOK_AND)? "and" :
+        (tok->type == TOK_INLINE)? "inline" :
+        (tok->type == TOK_VIRTUAL)? "virtual" :
+        (tok->type == TOK_SIGNED)? "signed" :
+        (tok->type == TOK_UNSIGNED)? "unsigned" :
+        (tok->type == TOK_FLOAT)? "float" :
+        (tok->type == TOK_NOT)? "not" :
+        (tok->type == TOK_ANY)? "any" :
+        (tok->type == TOK_FUNCTION)? "function" :
+        (tok->type == TOK_FUNC)? "func" :
+        (tok->type == TOK_VAR)? "var" :
+        (tok->type == TOK_VARIABLE)? "variable" :
+        (tok->type == TOK_PRINT)? "print" :
+        (tok->type == TOK_TRACE)? "trace" :
+        (tok->type == TOK_EXIT)? "exit" :
+
+        /* other tokens */
+        (tok->type == TOK_END_OF_FILE)? "end of file":
+        (tok->type == TOK_END_OF_INPUT)? "end of input":
+        (tok->type == TOK_LORE)? "<=":
+        (tok->type == TOK_GORE)? ">=":
+        (tok->type == TOK_EQU)? "==":
+        (tok->type == TOK_NEQU)? "!=":
+        (tok->type == TOK_OR)? "or":
+        (tok->type == TOK_AND)? "and":
+        (tok->type == TOK_NOT)? "not":
+        (tok->type == TOK_ADD_ASSIGN)? "+=":
+        (tok->type == TOK_SUB_ASSIGN)? "-=":
+        (tok->type == TOK_MUL_ASSIGN)? "*=":
+        (tok->type == TOK_DIV_ASSIGN)? "/=":
+        (tok->type == TOK_MOD_ASSIGN)? "%=":
+        (tok->type == TOK_ADD)? "+":
+        (tok->type == TOK_SUB)? "-":
+        (tok->type == TOK_ASSIGN)? "=":
+        (tok->type == TOK_DIV)? "/":
+        (tok->type == TOK_MUL)? "*":
+        (tok->type == TOK_MOD)? "%":
+        (tok->type == TOK_OPAREN)? "(":
+        (tok->type == TOK_CPAREN)? ")":
+        (tok->type == TOK_OCBRACE)? "{":
+        (tok->type == TOK_CCBRACE)? "}":
+        (tok->type == TOK_OSBRACE)? "[":
+        (tok->type == TOK_CSBRACE)? "]":
+        (tok->type == TOK_COMMA)? ",":
+        (tok->type == TOK_DOT)? ".":
+        (tok->type == TOK_OPBRACE)? "<":
+        (tok->type == TOK_CPBRACE)? ">":
+        (tok->type == TOK_COLON)? ":":
+        (tok->type == TOK_CARAT)? "^":
+        (tok->type == TOK_AMPER)? "&":
+        (tok->type == TOK_LITERAL_FLOAT)? "literal float":
+        (tok->type == TOK_LITERAL_SIGNED)? "literal signed":
+        (tok->type == TOK_LITERAL_UNSIGNED)? "literal unsigned":
+        (tok->type == TOK_LITERAL_DSTR)? "literal dstrg":
+        (tok->type == TOK_LITERAL_SSTR)? "literal sstrg":
+        (tok->type == TOK_SYMBOL)? "symbol":
+        (tok->type == TOK_RAW_TEXT)? "raw text":
+        (tok->type == TOK_UNARY_MINUS)? "unary minus": "UNKNOWN";
+}
+
+
@@ -0,0 +1,145 @@
+/* This file is generated with a script. Do not edit. */
+#ifndef _TOKENS_H
+#define _TOKENS_H
+#include <stdbool.h>
+#include "sstrings.h"
+#include "intern.h"
+
+typedef enum {
+    // markers
+    TOK_END_OF_FILE,
+    TOK_END_OF_INPUT,
+    TOK_ERROR,
+    
+    // keywords
+    TOK_AND,
+    TOK_ANY,
+    TOK_AS,
+    TOK_BOOLEAN,
+    TOK_BREAK,
+    TOK_CLASS,
+    TOK_CONST,
+    TOK_CONTINUE,
+    TOK_CREATE,
+    TOK_DESTROY,
+    TOK_DICT,
+    TOK_DO,
+    TOK_ELIF,
+    TOK_ELSE,
+    TOK_EXCEPT,
+    TOK_EXIT,
+    TOK_FALSE,
+    TOK_FINAL,
+    TOK_FLOAT,
+    TOK_FOR,
+    TOK_FUNC,
+    TOK_FUNCTION,
+    TOK_IF,
+    TOK_IMPORT,
+    TOK_IN,
+    TOK_INLINE,
+    TOK_LIST,
+    TOK_NAMESPACE,
+    TOK_NOT,
+    TOK_NOTHING,
+    TOK_OFF,
+    TOK_ON,
+    TOK_OR,
+    TOK_PRINT,
+    TOK_PRIVATE,
+    TOK_PROTECTED,
+    TOK_PUBLIC,
+    TOK_RAISE,
+    TOK_RETURN,
+    TOK_SIGNED,
+    TOK_START,
+    TOK_STRING,
+    TOK_STRUCT,
+    TOK_TRACE,
+    TOK_TRUE,
+    TOK_TRY,
+    TOK_TYPE,
+    TOK_UNSIGNED,
+    TOK_VAR,
+    TOK_VARIABLE,
+    TOK_VIRTUAL,
+    TOK_WHILE,
+    TOK_YIELD,
+
+    // operators
+    TOK_LORE,
+    TOK_GORE,
+    TOK_EQU,
+    TOK_NEQU,
+    TOK_ADD_ASSIGN,
+    TOK_SUB_ASSIGN,
+    TOK_MUL_ASSIGN,
+    TOK_DIV_ASSIGN,
+    TOK_MOD_ASSIGN,
+    TOK_ADD,
+    TOK_SUB,
+    TOK_ASSIGN,
+    TOK_DIV,
+    TOK_MUL,
+    TOK_MOD,
+    TOK_OPAREN,
+    TOK_CPAREN,
+    TOK_OCBRACE,
+    TOK_CCBRACE,
+    TOK_OSBRACE,
+    TOK_CSBRACE,
+    TOK_COMMA,
+    TOK_DOT,
+    TOK_OPBRACE,
+    TOK_CPBRACE,
+    TOK_COLON,
+    TOK_CARAT,
+    TOK_AMPER,
+
+    // constructed tokens
+    TOK_LITERAL_FLOAT,
+    TOK_LITERAL_SIGNED,
+    TOK_LITERAL_UNSIGNED,
+    TOK_LITERAL_DSTR,
+    TOK_LITERAL_SSTR,
+    TOK_SYMBOL,
+    TOK_RAW_TEXT,
+    TOK_UNARY_MINUS,
+} TokenType;
+
+/**
+ * @brief The parser expects a token to look like this.
+ */
+typedef struct {
+    const char* str;
+    TokenType type;
+} KeywordList;
+
+/**
+ * @brief The parser expects a token to look like this.
+ */
+typedef struct {
+    TokenType type;    // Type of the token
+    int line_no;       // Line number where the token was recognized
+    int col_no;        // Column of the last character of the token
+    int file_id;       // Source file where the token was taken
+    unsigned offset;   // Offset of the token text in the source file
+    unsigned len;      // Length of the token text in the source file
+    SymId sym;         // Interned name of a SYMBOL, otherwise SYMID_NONE
+    String* str;       // Text of the token, created when it is needed
+} Token;
+
+extern KeywordList keyword_list[];
+extern const int num_keywords;
+
+const char* tok_to_str(Token* tok);
+
+/*
+ * Look up a word in the keyword perfect hash. Keywords are not case
+ * sensitive. Returns the keyword token or TOK_SYMBOL if the word is not a
+ * keyword.
+ */
+TokenType find_keyword(const char* str, int len);
+
+#endif /* _TOKENS_H */
+
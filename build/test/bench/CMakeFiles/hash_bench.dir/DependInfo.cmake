@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/bench/hash_bench.c" "test/bench/CMakeFiles/hash_bench.dir/hash_bench.c.o" "gcc" "test/bench/CMakeFiles/hash_bench.dir/hash_bench.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/build/src/scanner/CMakeFiles/scan.dir/DependInfo.cmake"
+  "/root/repo/build/src/parse/CMakeFiles/parse.dir/DependInfo.cmake"
+  "/root/repo/build/src/ast/CMakeFiles/ast.dir/DependInfo.cmake"
+  "/root/repo/build/src/pass/CMakeFiles/pass.dir/DependInfo.cmake"
+  "/root/repo/build/src/symbols/CMakeFiles/symbols.dir/DependInfo.cmake"
+  "/root/repo/build/src/tokens/CMakeFiles/tokens.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
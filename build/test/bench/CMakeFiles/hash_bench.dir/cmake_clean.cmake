@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/hash_bench"
+  "/root/repo/bin/hash_bench.pdb"
+  "CMakeFiles/hash_bench.dir/hash_bench.c.o"
+  "CMakeFiles/hash_bench.dir/hash_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hash_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/scan_bench"
+  "/root/repo/bin/scan_bench.pdb"
+  "CMakeFiles/scan_bench.dir/scan_bench.c.o"
+  "CMakeFiles/scan_bench.dir/scan_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/scan_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -7,11 +7,15 @@
  * @date 02-25-2024
  * @copyright Copyright (c) 2024
  */
+#include <string.h>
+
 #include "ast.h"
 #include "errors.h"
 #include "memory.h"
 #include "trace.h"
 
+_Thread_local const bool* ast_visit = NULL;
+
 void traverse_ast(ast_module* node, PassFunc pre, PassFunc post) {
 
     ENTER;
@@ -31,6 +35,42 @@ void traverse_ast(ast_module* node, PassFunc pre, PassFunc post) {
     RET;
 }
 
+/**
+ * @brief Traverse the AST but only go into the nodes whose type is set in
+ * visit. A node that is left out is not given to the pass functions and
+ * neither is anything under it.
+ *
+ * @param node
+ * @param pre
+ * @param post
+ * @param visit
+ *
+ */
+void traverse_ast_visit(ast_module* node, PassFunc pre, PassFunc post, const bool* visit) {
+
+    ENTER;
+    const bool* save = ast_visit;
+    ast_visit        = visit;
+    traverse_ast(node, pre, post);
+    ast_visit = save;
+    RET;
+}
+
+/**
+ * @brief Return true if a traversal of a node of the type can visit a node
+ * of the other type.
+ *
+ * @param type
+ * @param below
+ * @return bool
+ *
+ */
+bool ast_type_reaches(AstType type, AstType below) {
+
+    int idx = below - AST_FIRST;
+    return (ast_reach[type - AST_FIRST][idx / 32] & (1u << (idx % 32))) != 0;
+}
+
 AstType ast_node_type(void* ptr) {
 
     return ((ast_node*)ptr)->type;
@@ -38,11 +78,64 @@ AstType ast_node_type(void* ptr) {
 
 ast_node* create_ast_node(AstType type, size_t size) {
 
-    ast_node* node = _ALLOC(size);
+    ast_node* node = _ARENA_ALLOC(size);
     node->type     = type;
     return node;
 }
 
+/**
+ * @brief Set up a buffer to collect the items of a list.
+ *
+ * @param buf
+ *
+ */
+void init_ast_buf(AstBuf* buf) {
+
+    buf->items = buf->local;
+    buf->len   = 0;
+    buf->cap   = AST_BUF_LOCAL;
+}
+
+/**
+ * @brief Add an item to the end of the list that is being collected. When
+ * the space is full the items are moved to a larger array in the arena.
+ * The old array is simply left behind, so a rule that fails has nothing to
+ * clean up.
+ *
+ * @param buf
+ * @param item
+ *
+ */
+void add_ast_buf(AstBuf* buf, void* item) {
+
+    if(buf->len >= buf->cap) {
+        void** items = _ARENA_ALLOC_ARRAY(void*, buf->cap << 1);
+        memcpy(items, buf->items, sizeof(void*) * buf->len);
+        buf->items = items;
+        buf->cap <<= 1;
+    }
+
+    buf->items[buf->len++] = item;
+}
+
+/**
+ * @brief Make the finished list for a node. The list is sized to fit and is
+ * taken from the arena along with the node. The buffer is empty after this.
+ *
+ * @param buf
+ * @return AstList*
+ *
+ */
+AstList* finish_ast_buf(AstBuf* buf) {
+
+    AstList* list = _ARENA_ALLOC(sizeof(AstList) + sizeof(void*) * buf->len);
+    list->len     = buf->len;
+    memcpy(list->items, buf->items, sizeof(void*) * buf->len);
+    init_ast_buf(buf);
+
+    return list;
+}
+
 const char* nterm_to_str(ast_node* node) {
 
     AstType type = ast_node_type(node);
@@ -111,7 +204,8 @@ const char* nterm_to_str(ast_node* node) {
                     (type == AST_print_statement)     ? "print_statement" :
                     (type == AST_exit_statement)      ? "exit_statement" :
                     (type == AST_start_function)      ? "start_function" :
-                    (type == AST_operator)            ? "operator" :
+                    (type == AST_expr_binary)         ? "expr_binary" :
+                    (type == AST_expr_unary)          ? "expr_unary" :
                     (type == AST_cast_statement)      ? "cast_statement" :
                     (type == AST_import_statement)    ? "import_statement" :
                     (type == AST_type_name_list)      ? "type_name_list" :
@@ -71,7 +71,8 @@ typedef enum {
     AST_raise_statement,
     AST_start_function,
     AST_import_statement,
-    AST_operator,
+    AST_expr_binary,
+    AST_expr_unary,
     AST_cast_statement,
     AST_case_item,
     AST_type_name_list,
@@ -86,12 +87,37 @@ typedef enum {
 } AstType;
 
 #include <stdbool.h>
+#include <stdint.h>
 
 typedef struct _ast_node_ {
     AstType type;
     bool seen; // used to detect infinite recursion.
 } ast_node;
 
+/*
+ * The children of a node that has a list of them. The list is made once,
+ * when the rule that owns it is finished, and it is never changed after
+ * that. The items are AST nodes, or tokens for the names.
+ */
+typedef struct {
+    int len;
+    void* items[];
+} AstList;
+
+/*
+ * Collects the children of a list while a rule is being parsed. It is a
+ * local variable of the rule and holds the first few items itself, so most
+ * lists are never allocated until they are finished.
+ */
+#define AST_BUF_LOCAL 8
+
+typedef struct {
+    void** items;
+    int len;
+    int cap;
+    void* local[AST_BUF_LOCAL];
+} AstBuf;
+
 #include "context.h"
 #include "parse_state.h"
 #include "scanner.h"
@@ -113,11 +139,23 @@ typedef void (*PassFunc)(ast_node* node);
 #include "strg.h"
 #include "vars.h"
 
+// the types that a traversal of each type can visit, the type included
+#define AST_REACH_WORDS (((AST_LAST - AST_FIRST) + 31) / 32)
+extern const uint32_t ast_reach[AST_LAST - AST_FIRST][AST_REACH_WORDS];
+
+// the types that the traversal goes into, NULL for all of them
+extern _Thread_local const bool* ast_visit;
+
 // public interface
 void traverse_ast(ast_module* node, PassFunc pre, PassFunc post);
+void traverse_ast_visit(ast_module* node, PassFunc pre, PassFunc post, const bool* visit);
+bool ast_type_reaches(AstType type, AstType below);
 AstType ast_node_type(void* node);
 const char* nterm_to_str(ast_node* node);
 ast_node* create_ast_node(AstType type, size_t size);
+void init_ast_buf(AstBuf* buf);
+void add_ast_buf(AstBuf* buf, void* item);
+AstList* finish_ast_buf(AstBuf* buf);
 
 // hide the icky syntax
 #define AST_CALLBACK(f, n)          \
@@ -125,6 +163,12 @@ ast_node* create_ast_node(AstType type, size_t size);
         if(NULL != (f))             \
             (*(f))((ast_node*)(n)); \
     } while(false)
+// leave out a subtree that has nothing in it that the passes want
+#define AST_PRUNE(n)                                                                      \
+    do {                                                                                  \
+        if(ast_visit != NULL && (n) != NULL && !ast_visit[ast_node_type(n) - AST_FIRST]) \
+            return;                                                                       \
+    } while(false)
 #define CREATE_AST_NODE(t, n) (n*)create_ast_node((t), sizeof(n))
 #define TRAVERSE_ERROR AST_FIRST
 
@@ -29,14 +29,13 @@ void traverse_compound_name(ast_compound_name* node, PassFunc pre, PassFunc post
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
     TRACE("raw_name: %s", raw_string(node->raw_name));
-    Token* tok;
 
-    void* mark = NULL;
-    while(NULL != (tok = iter_link_list(node->list, &mark))) {
-        TRACE_TERM(tok);
+    for(int i = 0; i < node->list->len; i++) {
+        TRACE_TERM(node->list->items[i]);
     }
     AST_CALLBACK(post, node);
     RET;
@@ -56,13 +55,12 @@ void traverse_compound_name_list(ast_compound_name_list* node, PassFunc pre, Pas
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    ast_compound_name* nterm;
-    void* mark = NULL;
-    while(NULL != (nterm = (ast_compound_name*)iter_link_list(node->list, &mark)))
-        traverse_compound_name(nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_compound_name(node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -81,6 +79,7 @@ void traverse_compound_ref_item(ast_compound_ref_item* node, PassFunc pre, PassF
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -105,13 +104,12 @@ void traverse_compound_reference(ast_compound_reference* node, PassFunc pre, Pas
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
-    ast_compound_ref_item* nterm;
 
-    void* mark = NULL;
-    while(NULL != (nterm = iter_link_list(node->list, &mark))) {
-        traverse_compound_ref_item(nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++) {
+        traverse_compound_ref_item(node->list->items[i], pre, post);
     }
 
     AST_CALLBACK(post, node);
@@ -17,7 +17,7 @@
  */
 typedef struct _ast_compound_name_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
     String* raw_name;
 } ast_compound_name;
 
@@ -28,7 +28,7 @@ typedef struct _ast_compound_name_ {
  */
 typedef struct _ast_compound_name_list_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_compound_name_list;
 
 /**
@@ -47,7 +47,7 @@ typedef struct _ast_compound_ref_item_ {
  */
 typedef struct _ast_compound_reference_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_compound_reference;
 
 void traverse_compound_name(ast_compound_name* node, PassFunc pre, PassFunc post);
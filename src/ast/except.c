@@ -27,17 +27,15 @@ void traverse_try_clause(ast_try_clause* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
     traverse_function_body(node->fbod, pre, post);
 
-    void* mark = NULL;
-    ast_except_clause* ecl;
-
     if(NULL != node->except_list) {
-        while(NULL != (ecl = iter_link_list(node->except_list, &mark)))
-            traverse_except_clause(ecl, pre, post);
+        for(int i = 0; i < node->except_list->len; i++)
+            traverse_except_clause(node->except_list->items[i], pre, post);
     }
 
     if(NULL != node->final)
@@ -60,6 +58,7 @@ void traverse_except_clause(ast_except_clause* node, PassFunc pre, PassFunc post
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -84,6 +83,7 @@ void traverse_final_clause(ast_final_clause* node, PassFunc pre, PassFunc post)
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
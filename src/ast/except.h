@@ -19,7 +19,7 @@ typedef struct _ast_try_clause_ {
     ast_node node;
     struct _ast_function_body_* fbod;
     struct _ast_final_clause_* final;
-    LinkList* except_list;
+    AstList* except_list;
 } ast_try_clause;
 
 /**
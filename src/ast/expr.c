@@ -15,6 +15,31 @@
 #include "link_list.h"
 #include "trace.h"
 
+/**
+ * @brief Traverse one of the nodes that can be in an expression tree.
+ *
+ * @param nterm
+ * @param pre
+ * @param post
+ *
+ */
+static void traverse_expr_node(ast_node* nterm, PassFunc pre, PassFunc post) {
+
+    switch(ast_node_type(nterm)) {
+        case AST_expr_binary:
+            traverse_expr_binary((ast_expr_binary*)nterm, pre, post);
+            break;
+        case AST_expr_unary:
+            traverse_expr_unary((ast_expr_unary*)nterm, pre, post);
+            break;
+        case AST_expr_primary:
+            traverse_expr_primary((ast_expr_primary*)nterm, pre, post);
+            break;
+        default:
+            fatal_error("expected an expression node, but got %s", nterm_to_str(nterm));
+    }
+}
+
 /**
  * @brief
  *
@@ -25,64 +50,67 @@ void traverse_expression(ast_expression* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
-    ast_node* nterm;
 
     TRACE("operand type: %d", node->operand_type);
     TRACE("expression type: %d", node->expr_type);
-    if(node->list != NULL) {
-        void* mark = NULL;
-        while(NULL != (nterm = iter_link_list(node->list, &mark))) {
-            if(AST_expr_primary == ast_node_type(nterm))
-                traverse_expr_primary((ast_expr_primary*)nterm, pre, post);
-            else if(AST_operator == ast_node_type(nterm))
-                traverse_operator((ast_operator*)nterm, pre, post);
-            else
-                fatal_error("expected a primary or operator, but got %s",
-                            nterm_to_str(nterm));
-        }
-    }
+    traverse_expr_node(node->expr, pre, post);
 
     AST_CALLBACK(post, node);
     RET;
 }
 
 /**
- * @brief
+ * @brief The left side is traversed before the right side, so the operands
+ * are seen in the order that they appear in the source.
+ *
+ *  expr_binary
+ *      = expression oper expression
+ *
+ * @param node
+ * @param pre
+ * @param post
  *
- *  ast_operator
- *      = AND
- *      / OR
- *      / '=='
- *      / '!='
- *      / '<'
- *      / '>'
- *      / '<='
- *      / '>='
- *      / '+'
- *      / '-'
- *      / '*'
- *      / '/'
- *      / '%'
- *      / '^'
- *      / UNARY_MINUS
- *      / '!'
- *      / '('
- *      / ')'
+ */
+void traverse_expr_binary(ast_expr_binary* node, PassFunc pre, PassFunc post) {
+
+    assert(node != NULL);
+
+    AST_PRUNE(node);
+    ENTER;
+    AST_CALLBACK(pre, node);
+
+    TRACE_TERM(node->oper);
+    traverse_expr_node(node->lhs, pre, post);
+    traverse_expr_node(node->rhs, pre, post);
 
+    AST_CALLBACK(post, node);
+    RET;
+}
+
+/**
+ * @brief
+ *
+ *  expr_unary
+ *      = oper expression
+ *
  * @param node
  * @param pre
+ * @param post
  *
  */
-void traverse_operator(ast_operator* node, PassFunc pre, PassFunc post) {
+void traverse_expr_unary(ast_expr_unary* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    TRACE_TERM(node->tok);
+    TRACE_TERM(node->oper);
+    traverse_expr_node(node->operand, pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -102,6 +130,7 @@ void traverse_cast_statement(ast_cast_statement* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -126,6 +155,7 @@ void traverse_expr_primary(ast_expr_primary* node, PassFunc pre, PassFunc post)
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -156,14 +186,13 @@ void traverse_expression_list(ast_expression_list* node, PassFunc pre, PassFunc
 
     // assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     if(node != NULL) {
         AST_CALLBACK(pre, node);
 
-        ast_node* nterm;
-        void* mark = NULL;
-        while(NULL != (nterm = iter_link_list(node->list, &mark)))
-            traverse_expression((ast_expression*)nterm, pre, post);
+        for(int i = 0; i < node->list->len; i++)
+            traverse_expression((ast_expression*)node->list->items[i], pre, post);
 
         AST_CALLBACK(post, node);
     }
@@ -187,6 +216,7 @@ void traverse_assignment_item(ast_assignment_item* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -236,6 +266,7 @@ void traverse_assignment(ast_assignment* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
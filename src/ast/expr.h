@@ -12,61 +12,46 @@
 #include "ast.h"
 
 /**
- *  Note that this does not match what is actually implemented. Expressions
- *  are actually implemented using the shunting yard algoritim. This is here
- *  as a place marker and illustration.
+ *  The expression is the root of a tree of expr_binary, expr_unary, and
+ *  expr_primary nodes. The precedence of the operators and the parentheses
+ *  are captured by the shape of the tree.
  *
  *  expression
- *      = expr_and 'or' expr_or
- *      / expr_equ 'and' expr_and
- *      / expr_mag '==' expr_equ
- *      / expr_mag '!=' expr_equ
- *      / expr_term '<' expr_mag
- *      / expr_term '>' expr_mag
- *      / expr_term '<=' expr_mag
- *      / expr_term '>=' expr_mag
- *      / expr_fact '+' expr_term
- *      / expr_fact '-' expr_term
- *      / expr_pow '*' expr_fact
- *      / expr_pow '/' expr_fact
- *      / expr_pow '%' expr_fact
- *      / expr_unary '^' expr_pow
- *      / '!' expr_primary
- *      / '-' expr_primary
- *      / '(' expression ')'
+ *      = expr_and ( 'or' expr_and )*
+ *
+ *  ...
+ *
+ *  expr_unary
+ *      = '!' expr_unary
+ *      / '-' expr_unary
+ *      / expr_primary
  */
 typedef struct _ast_expression_ {
     ast_node node;
-    LinkList* list;
+    ast_node* expr;   // expr_binary, expr_unary, or expr_primary
     int expr_type;    // the type of the expression result
     int operand_type; // the type of operand that is being operated upon
 } ast_expression;
 
 /**
- *  ast_operator
- *      = AND
- *      / OR
- *      / '=='
- *      / '!='
- *      / '<'
- *      / '>'
- *      / '<='
- *      / '>='
- *      / '+'
- *      / '-'
- *      / '*'
- *      / '/'
- *      / '%'
- *      / '^'
- *      / UNARY_MINUS
- *      / '!'
- *      / '('
- *      / ')'
+ *  An operator with an operand on each side. The operator is one of
+ *  AND, OR, '==', '!=', '<', '>', '<=', '>=', '+', '-', '*', '/', '%', '^'.
  */
-typedef struct _ast_operator_ {
+typedef struct _ast_expr_binary_ {
     ast_node node;
-    Token* tok;
-} ast_operator;
+    Token* oper;
+    ast_node* lhs;
+    ast_node* rhs;
+} ast_expr_binary;
+
+/**
+ *  A prefix operator. The operator is '!' or UNARY_MINUS.
+ */
+typedef struct _ast_expr_unary_ {
+    ast_node node;
+    Token* oper;
+    ast_node* operand;
+} ast_expr_unary;
 
 /**
  * cast_statement
@@ -95,7 +80,7 @@ typedef struct _ast_expr_primary_ {
  */
 typedef struct _ast_expression_list_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_expression_list;
 
 /**
@@ -133,7 +118,8 @@ void traverse_expr_primary(ast_expr_primary* node, PassFunc pre, PassFunc post);
 void traverse_expression_list(ast_expression_list* node, PassFunc pre, PassFunc post);
 void traverse_assignment_item(ast_assignment_item* node, PassFunc pre, PassFunc post);
 void traverse_assignment(ast_assignment* node, PassFunc pre, PassFunc post);
-void traverse_operator(ast_operator* node, PassFunc pre, PassFunc post);
+void traverse_expr_binary(ast_expr_binary* node, PassFunc pre, PassFunc post);
+void traverse_expr_unary(ast_expr_unary* node, PassFunc pre, PassFunc post);
 
 
 #endif /* __EXPR_H__ */
@@ -27,19 +27,17 @@ void traverse_if_clause(ast_if_clause* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    void* mark = NULL;
-    ast_node* nterm;
-
     traverse_expression(node->expr, pre, post);
     traverse_function_body(node->fbod, pre, post);
 
     // normally this list will simply be empty...
     if(NULL != node->elif_list) {
-        while(NULL != (nterm = iter_link_list(node->elif_list, &mark)))
-            traverse_elif_clause((ast_elif_clause*)nterm, pre, post);
+        for(int i = 0; i < node->elif_list->len; i++)
+            traverse_elif_clause((ast_elif_clause*)node->elif_list->items[i], pre, post);
     }
 
     if(NULL != node->eclaus)
@@ -62,6 +60,7 @@ void traverse_else_clause(ast_else_clause* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -84,6 +83,7 @@ void traverse_elif_clause(ast_elif_clause* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
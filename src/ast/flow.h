@@ -20,7 +20,7 @@ typedef struct _ast_if_clause_ {
     struct _ast_expression_* expr;
     struct _ast_function_body_* fbod;
     struct _ast_else_clause_* eclaus;
-    LinkList* elif_list;
+    AstList* elif_list;
 } ast_if_clause;
 
 /**
@@ -27,6 +27,7 @@ void traverse_function_reference(ast_function_reference* node, PassFunc pre, Pas
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -47,6 +48,7 @@ void traverse_create_reference(ast_create_reference* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -66,6 +68,7 @@ void traverse_destroy_reference(ast_destroy_reference* node, PassFunc pre, PassF
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -89,6 +92,7 @@ void traverse_function_declaration(ast_function_declaration* node, PassFunc pre,
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -115,6 +119,7 @@ void traverse_create_declaration(ast_create_declaration* node, PassFunc pre, Pas
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -139,6 +144,7 @@ void traverse_destroy_declaration(ast_destroy_declaration* node, PassFunc pre, P
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -163,6 +169,7 @@ void traverse_function_definition(ast_function_definition* node, PassFunc pre, P
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -190,13 +197,12 @@ void traverse_create_name(ast_create_name* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    Token* tok;
-    void* mark = NULL;
-    while(NULL != (tok = iter_link_list(node->list, &mark)))
-        TRACE_TERM(tok);
+    for(int i = 0; i < node->list->len; i++)
+        TRACE_TERM(node->list->items[i]);
 
     AST_CALLBACK(post, node);
     RET;
@@ -216,13 +222,12 @@ void traverse_destroy_name(ast_destroy_name* node, PassFunc pre, PassFunc post)
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    Token* tok;
-    void* mark = NULL;
-    while(NULL != (tok = iter_link_list(node->list, &mark)))
-        TRACE_TERM(tok);
+    for(int i = 0; i < node->list->len; i++)
+        TRACE_TERM(node->list->items[i]);
 
     AST_CALLBACK(post, node);
     RET;
@@ -242,6 +247,7 @@ void traverse_create_definition(ast_create_definition* node, PassFunc pre, PassF
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -268,6 +274,7 @@ void traverse_destroy_definition(ast_destroy_definition* node, PassFunc pre, Pas
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -293,13 +300,15 @@ void traverse_function_body(ast_function_body* node, PassFunc pre, PassFunc post
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
     if(node->list != NULL) {
-        ast_function_body_element* elem;
-        void* mark = NULL;
-        while(NULL != (elem = iter_link_list(node->list, &mark)))
-            traverse_function_body_element(elem, pre, post);
+        for(int i = 0; i < node->list->len; i++)
+            traverse_function_body_element(node->list->items[i], pre, post);
+    }
+    else if(node->lazy != NULL) {
+        TRACE("function body is not parsed");
     }
     else
         TRACE("no function body");
@@ -322,6 +331,7 @@ void traverse_start_function(ast_start_function* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -339,6 +349,7 @@ void traverse_function_assignment(ast_function_assignment* node, PassFunc pre, P
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -94,7 +94,7 @@ typedef struct _ast_function_definition_ {
  */
 typedef struct _ast_create_name_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_create_name;
 
 /**
@@ -105,7 +105,7 @@ typedef struct _ast_create_name_ {
  */
 typedef struct _ast_destroy_name_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_destroy_name;
 
 /**
@@ -137,7 +137,10 @@ typedef struct _ast_destroy_definition_ {
  */
 typedef struct _ast_function_body_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
+    Token* lazy;     // the '{' of a body that was skipped, NULL once it is parsed
+    int lazy_offset; // where the '{' is in the source
+    int lazy_end;    // where the source after the '}' starts
 } ast_function_body;
 
 /**
@@ -46,6 +46,7 @@ void traverse_function_body_element(ast_function_body_element* node, PassFunc pr
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -132,6 +133,7 @@ void traverse_break_statement(ast_break_statement* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -152,6 +154,7 @@ void traverse_continue_statement(ast_continue_statement* node, PassFunc pre, Pas
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -172,6 +175,7 @@ void traverse_inline_statement(ast_inline_statement* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -194,6 +198,7 @@ void traverse_yield_statement(ast_yield_statement* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -238,6 +243,7 @@ void traverse_return_statement(ast_return_statement* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -258,6 +264,7 @@ void traverse_raise_statement(ast_raise_statement* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -282,6 +289,7 @@ void traverse_trace_statement(ast_trace_statement* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -305,6 +313,7 @@ void traverse_print_statement(ast_print_statement* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -328,6 +337,7 @@ void traverse_exit_statement(ast_exit_statement* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -26,12 +26,17 @@ void traverse_import_statement(ast_import_statement* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    TRACE_TERM(node->name);
+    if(node->name != NULL) {
+        TRACE_TERM(node->name);
+    }
     TRACE_TERM(node->mod);
-    traverse_module(node->module, pre, post);
+    // the first import of a module is the one that visits it
+    if(!node->cached)
+        traverse_module(node->module, pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -22,6 +22,7 @@ typedef struct _ast_import_statement_ {
     Token* name;                 // optional alternative name
     Token* mod;                  // module to import
     struct _ast_module_* module; // imported module
+    bool cached;                 // the module was parsed by an earlier import
 } ast_import_statement;
 
 void traverse_import_statement(ast_import_statement* node, PassFunc pre, PassFunc post);
@@ -27,13 +27,12 @@ void traverse_list_init(ast_list_init* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    void* mark = NULL;
-    ast_assignment_item* item;
-    while(NULL != (item = iter_link_list(node->list, &mark)))
-        traverse_assignment_item(item, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_assignment_item(node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -52,6 +51,7 @@ void traverse_dict_init_element(ast_dict_init_element* node, PassFunc pre, PassF
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -75,13 +75,12 @@ void traverse_dict_init(ast_dict_init* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    void* mark = NULL;
-    ast_dict_init_element* elem;
-    while(NULL != (elem = iter_link_list(node->list, &mark)))
-        traverse_dict_init_element(elem, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_dict_init_element(node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -100,6 +99,7 @@ void traverse_array_param(ast_array_param* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -131,13 +131,12 @@ void traverse_array_param_list(ast_array_param_list* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    void* mark = NULL;
-    ast_array_param* item;
-    while(NULL != (item = iter_link_list(node->list, &mark)))
-        traverse_array_param(item, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_array_param(node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -156,6 +155,7 @@ void traverse_array_reference(ast_array_reference* node, PassFunc pre, PassFunc
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
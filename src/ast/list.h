@@ -17,7 +17,7 @@
  */
 typedef struct _ast_list_init_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_list_init;
 
 /**
@@ -36,7 +36,7 @@ typedef struct _ast_dict_init_element_ {
  */
 typedef struct _ast_dict_init_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_dict_init;
 
 /**
@@ -54,7 +54,7 @@ typedef struct _ast_array_param_ {
  */
 typedef struct _ast_array_param_list_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_array_param_list;
 
 /**
@@ -29,6 +29,7 @@ void traverse_scope_operator(ast_scope_operator* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -59,6 +60,7 @@ void traverse_literal_type_name(ast_literal_type_name* node, PassFunc pre, PassF
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -85,6 +87,7 @@ void traverse_literal_value(ast_literal_value* node, PassFunc pre, PassFunc post
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -111,6 +114,7 @@ void traverse_type_name(ast_type_name* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -144,14 +148,12 @@ void traverse_type_name_list(ast_type_name_list* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    ast_type_name* nterm;
-
-    void* mark = NULL;
-    while(NULL != (nterm = (ast_type_name*)iter_link_list(node->list, &mark)))
-        traverse_type_name(nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_type_name(node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -78,7 +78,7 @@ typedef struct _ast_type_name_ {
  */
 typedef struct _ast_type_name_list_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_type_name_list;
 
 /**
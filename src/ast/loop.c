@@ -26,6 +26,7 @@ void traverse_while_definition(ast_while_definition* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -51,6 +52,7 @@ void traverse_while_clause(ast_while_clause* node, PassFunc pre, PassFunc post)
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -74,6 +76,7 @@ void traverse_do_clause(ast_do_clause* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -98,6 +101,7 @@ void traverse_for_clause(ast_for_clause* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
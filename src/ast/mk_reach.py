@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+'''
+Make the table of the node types that a traversal can reach.
+
+A pass that only has callbacks for some node types does not need to go into
+a subtree that cannot have any of those types in it. This reads the
+traverse_* functions out of the AST sources and follows the calls that they
+make to each other, so the table cannot drift from the code. The function
+traverse_xxx is taken to be the one that visits nodes of type AST_xxx. Other
+traverse functions, like traverse_expr_node(), are helpers and the types
+that they reach are added to the function that calls them.
+
+usage: mk_reach.py ast.h source.c ...
+
+The output is ast_reach.c in the current directory. Each row is a bit set of
+the types that a traversal of a node of the type can visit, the type itself
+included.
+'''
+import re
+import sys
+
+
+def error(msg):
+    sys.stderr.write('mk_reach.py: error: %s\n' % (msg))
+    sys.exit(1)
+
+
+def read_types(fname):
+    '''
+    Return the names of the AstType values, without the prefix, in order.
+    '''
+    with open(fname) as fh:
+        text = fh.read()
+
+    m = re.search(r'typedef enum \{(.*?)\} AstType;', text, re.S)
+    if m is None:
+        error('cannot find AstType in %s' % (fname))
+
+    names = []
+    for line in m.group(1).split('\n'):
+        line = re.sub(r'//.*', '', line).strip()
+        m = re.match(r'AST_(\w+)', line)
+        if m is None or m.group(1) in ('FIRST', 'LAST'):
+            continue
+        names.append(m.group(1))
+
+    return names
+
+
+def read_calls(fnames):
+    '''
+    Return a dict of traverse function names to the set of traverse
+    functions that they call.
+    '''
+    calls = {}
+    for fname in fnames:
+        with open(fname) as fh:
+            text = re.sub(r'/\*.*?\*/', '', fh.read(), flags=re.S)
+            text = re.sub(r'//.*', '', text)
+
+        for m in re.finditer(r'^(?:static )?void traverse_(\w+)\(.*?\{(.*?)\n\}', text, re.S | re.M):
+            name, body = m.group(1), m.group(2)
+            calls[name] = set(re.findall(r'\btraverse_(\w+)\(', body))
+
+    return calls
+
+
+def reach(types, calls):
+    '''
+    Return a dict of type names to the set of type names that a traversal
+    of the type can visit.
+    '''
+    below = {}
+
+    def direct(name, seen):
+        # the types that a function visits itself or through helpers
+        found = set()
+        for callee in sorted(calls.get(name, ())):
+            if callee in types:
+                found.add(callee)
+            elif callee not in seen:
+                seen.add(callee)
+                found |= direct(callee, seen)
+        return found
+
+    # a type that has no traverse function is never visited
+    for name in types:
+        below[name] = direct(name, set([name]))
+
+    result = {}
+    for name in types:
+        found = set([name])
+        todo = [name]
+        while todo:
+            for callee in below[todo.pop()]:
+                if callee not in found:
+                    found.add(callee)
+                    todo.append(callee)
+        result[name] = found
+
+    return result
+
+
+def emit(types, result, fh):
+
+    words = (len(types) + 31) // 32
+
+    fh.write('/* This file is generated with a script. Do not edit. */\n')
+    fh.write('#include <stdint.h>\n\n')
+    fh.write('#include "ast.h"\n\n')
+
+    fh.write('const uint32_t ast_reach[AST_LAST - AST_FIRST][AST_REACH_WORDS] = {\n')
+    for name in types:
+        bits = [0] * words
+        for callee in result[name]:
+            idx = types.index(callee)
+            bits[idx // 32] |= 1 << (idx % 32)
+        fh.write('    [AST_%s - AST_FIRST] = {%s},\n' % (name, ', '.join('0x%08x' % b for b in bits)))
+    fh.write('};\n')
+
+
+if __name__ == '__main__':
+
+    if len(sys.argv) < 3:
+        error('usage: mk_reach.py ast.h source.c ...')
+
+    types = read_types(sys.argv[1])
+    calls = read_calls(sys.argv[2:])
+    result = reach(types, calls)
+
+    with open('ast_reach.c', 'w') as fh:
+        emit(types, result, fh)
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+'''
+Make the field schema of the AST node structs.
+
+The node pool needs to know, for every AstType, which fields of the node
+struct hold other nodes, tokens, lists, or plain values so that it can
+pack a tree into indexes and build it back again. This reads the structs
+out of the AST headers so the schema cannot drift from the code.
+
+usage: mk_schema.py ast.h header.h ...
+
+The output is ast_schema.c in the current directory. The build fails if a
+field has a type that the pool does not know how to store. A node type
+that has no struct cannot be created, so its entry is left empty.
+'''
+import re
+import sys
+
+# what the pool does with each field type
+kinds = {
+    'ast_node*': 'POOL_NODE',
+    'Token*': 'POOL_TOKEN',
+    'AstList*': 'POOL_LIST',
+    'String*': 'POOL_STRING',
+    'bool': 'POOL_BOOL',
+    'int': 'POOL_INT',
+    'ScopeType': 'POOL_INT',
+    # filled in by the passes, the pool only holds the syntax
+    'SymContext*': 'POOL_SKIP',
+}
+
+
+def error(msg):
+    sys.stderr.write('mk_schema.py: error: %s\n' % (msg))
+    sys.exit(1)
+
+
+def read_types(fname):
+    '''
+    Return the names of the AstType values, without the prefix, in order.
+    '''
+    with open(fname) as fh:
+        text = fh.read()
+
+    m = re.search(r'typedef enum \{(.*?)\} AstType;', text, re.S)
+    if m is None:
+        error('cannot find AstType in %s' % (fname))
+
+    names = []
+    for line in m.group(1).split('\n'):
+        line = re.sub(r'//.*', '', line).strip()
+        m = re.match(r'AST_(\w+)', line)
+        if m is None or m.group(1) in ('FIRST', 'LAST'):
+            continue
+        names.append(m.group(1))
+
+    return names
+
+
+def read_structs(fnames):
+    '''
+    Return a dict of node struct names to a list of (field, kind) pairs.
+    '''
+    structs = {}
+    for fname in fnames:
+        with open(fname) as fh:
+            text = re.sub(r'/\*.*?\*/', '', fh.read(), flags=re.S)
+
+        for m in re.finditer(r'typedef struct _ast_\w+_ \{(.*?)\n\} ast_(\w+);', text, re.S):
+            body, name = m.group(1), m.group(2)
+            if name == 'node':
+                continue
+            # a union is stored as it is, 64 bits
+            body = re.sub(r'union \{.*?\}\s*(\w+);', r'union \1;', body, flags=re.S)
+
+            fields = []
+            for line in body.split('\n'):
+                line = re.sub(r'//.*', '', line).strip()
+                if line == '' or line == 'ast_node node;':
+                    continue
+
+                fm = re.match(r'(.*?)\s*(\w+);$', line)
+                if fm is None:
+                    error('%s: cannot read the field "%s" of ast_%s' % (fname, line, name))
+
+                ftype = re.sub(r'\s+\*', '*', fm.group(1))
+                if ftype == 'union':
+                    kind = 'POOL_QUAD'
+                elif re.match(r'struct _ast_\w+_\*$', ftype):
+                    kind = 'POOL_NODE'
+                elif ftype in kinds:
+                    kind = kinds[ftype]
+                else:
+                    error('%s: the pool cannot store "%s %s" of ast_%s' % (fname, ftype, fm.group(2), name))
+
+                fields.append((fm.group(2), kind))
+
+            structs[name] = fields
+
+    return structs
+
+
+def emit(types, structs, fh):
+
+    fh.write('/* This file is generated with a script. Do not edit. */\n')
+    fh.write('#include <stddef.h>\n\n')
+    fh.write('#include "ast.h"\n')
+    fh.write('#include "pool.h"\n\n')
+
+    # the pool format depends on the order and kind of the fields only
+    hash = 2166136261
+    for name in types:
+        for c in ('%s{%s}' % (name, ','.join('%s:%s' % f for f in structs.get(name, [])))).encode():
+            hash = ((hash ^ c) * 16777619) & 0xffffffff
+
+    for name in types:
+        if len(structs.get(name, [])) == 0:
+            continue
+        fh.write('static const AstField fields_%s[] = {\n' % (name))
+        for field, kind in structs[name]:
+            fh.write('    {offsetof(ast_%s, %s), %s},\n' % (name, field, kind))
+        fh.write('};\n\n')
+
+    fh.write('const AstSchema ast_schema[AST_LAST - AST_FIRST] = {\n')
+    for name in types:
+        if name not in structs:
+            fh.write('    [AST_%s - AST_FIRST] = {"%s", 0, 0, NULL},\n' % (name, name))
+            continue
+        nfields = len(structs[name])
+        fields = ('fields_%s' % (name)) if nfields > 0 else 'NULL'
+        fh.write('    [AST_%s - AST_FIRST] = {"%s", sizeof(ast_%s), %d, %s},\n'
+                 % (name, name, name, nfields, fields))
+    fh.write('};\n\n')
+
+    fh.write('const uint32_t ast_schema_hash = 0x%08x;\n' % (hash))
+
+
+if __name__ == '__main__':
+
+    if len(sys.argv) < 3:
+        error('usage: mk_schema.py ast.h header.h ...')
+
+    types = read_types(sys.argv[1])
+    structs = read_structs(sys.argv[2:])
+
+    with open('ast_schema.c', 'w') as fh:
+        emit(types, structs, fh)
@@ -30,14 +30,12 @@ void traverse_module(ast_module* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    ast_node* nterm;
-
-    void* mark = NULL;
-    while(NULL != (nterm = iter_link_list(node->list, &mark))) {
-        traverse_module_item((ast_module_item*)nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++) {
+        traverse_module_item((ast_module_item*)node->list->items[i], pre, post);
     }
 
     AST_CALLBACK(post, node);
@@ -61,6 +59,7 @@ void traverse_module_item(ast_module_item* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -103,6 +102,7 @@ void traverse_namespace_item(ast_namespace_item* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -151,18 +151,17 @@ void traverse_namespace_definition(ast_namespace_definition* node, PassFunc pre,
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    TRACE("NAME: %s", raw_string(node->name->str));
+    TRACE("NAME: %s", token_text(node->name));
     TRACE("SCOPE: %s", scope_name(node->scope));
     const char* s = get_sym_context(node->context);
     TRACE("CONTEXT: %s", s);
-    ast_node* nterm;
 
-    void* mark = NULL;
-    while(NULL != (nterm = iter_link_list(node->list, &mark)))
-        traverse_namespace_item((ast_namespace_item*)nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_namespace_item((ast_namespace_item*)node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -185,6 +184,7 @@ void traverse_class_item(ast_class_item* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -229,21 +229,19 @@ void traverse_class_definition(ast_class_definition* node, PassFunc pre, PassFun
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    TRACE("NAME: %s", raw_string(node->name->str));
+    TRACE("NAME: %s", token_text(node->name));
     TRACE("SCOPE: %s", scope_name(node->scope));
     const char* s = get_sym_context(node->context);
     TRACE("CONTEXT: %s", s);
     if(node->parent)
         traverse_type_name(node->parent, pre, post);
 
-    ast_node* nterm;
-
-    void* mark = NULL;
-    while(NULL != (nterm = iter_link_list(node->list, &mark)))
-        traverse_class_item((ast_class_item*)nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_class_item((ast_class_item*)node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -254,6 +252,7 @@ void traverse_class_var_declaration(ast_class_var_declaration* node, PassFunc pr
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -17,7 +17,7 @@
  */
 typedef struct _ast_module_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_module;
 
 /**
@@ -53,7 +53,7 @@ typedef struct _ast_namespace_item_ {
 typedef struct _ast_namespace_definition_ {
     ast_node node;
     Token* name;
-    LinkList* list;
+    AstList* list;
     ScopeType scope;
     SymContext* context;
 } ast_namespace_definition;
@@ -89,7 +89,7 @@ typedef struct _ast_class_definition_ {
     ast_node node;
     Token* name;
     struct _ast_type_name_* parent;
-    LinkList* list;
+    AstList* list;
     ScopeType scope;
     SymContext* context;
 } ast_class_definition;
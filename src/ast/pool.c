@@ -0,0 +1,661 @@
+/**
+ * @file pool.c
+ *
+ * @brief The AST node pool. A module's tree is packed into one block where
+ * every node, token, list, and string is referred to by a 32 bit index
+ * instead of a pointer. The block does not depend on where it is in memory,
+ * so it can be written to a file as it is and read back, or mapped, and
+ * used without fixing anything up.
+ *
+ * The passes work on the pointer form of the tree, so a pool is expanded
+ * back into nodes in the compile arena before it is traversed. The nodes
+ * are stored with their children first, so this is one pass over the
+ * block.
+ *
+ * What each field of a node holds comes from the schema that mk_schema.py
+ * generates from the AST headers. The symbol contexts are not stored. They
+ * are made by the symbol pass after the tree is built.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "errors.h"
+#include "fileio.h"
+#include "hash.h"
+#include "memory.h"
+#include "pool.h"
+#include "trace.h"
+
+// most words a single node can need for its fields
+#define POOL_MAX_WORDS 16
+
+// top bit of the length of a list of tokens
+#define POOL_TOKEN_LIST 0x80000000u
+
+_Static_assert(sizeof(ScopeType) == sizeof(uint32_t), "ScopeType is stored in one word");
+_Static_assert(sizeof(AstPool) % sizeof(uint32_t) == 0, "pool header is not a whole number of words");
+_Static_assert(sizeof(AstPoolToken) % sizeof(uint32_t) == 0, "pool token is not a whole number of words");
+
+typedef struct {
+    uint32_t* words;
+    uint32_t len;
+    uint32_t cap;
+} WordBuf;
+
+/*
+ * Finds the index that a node or a token was given, so that anything that
+ * is referred to more than once is only stored once.
+ */
+typedef struct {
+    const void** keys;
+    uint32_t* vals;
+    uint32_t cap;
+    uint32_t count;
+} PtrMap;
+
+typedef struct {
+    WordBuf nodes;
+    WordBuf lists;
+    AstPoolToken* tokens;
+    uint32_t num_tokens;
+    uint32_t cap_tokens;
+    char* text;
+    uint32_t text_len;
+    uint32_t text_cap;
+    uint32_t num_nodes;
+    PtrMap node_map;
+    PtrMap token_map;
+    HashTable* text_map;
+} PackState;
+
+/**
+ * @brief Make room for more words at the end of the buffer and return the
+ * index of the first one.
+ *
+ * @param buf
+ * @param count
+ * @return uint32_t
+ */
+static uint32_t grow_words(WordBuf* buf, uint32_t count) {
+
+    if(buf->len + count > buf->cap) {
+        while(buf->len + count > buf->cap)
+            buf->cap = (buf->cap == 0) ? 0x400 : buf->cap << 1;
+        buf->words = _REALLOC_ARRAY(buf->words, uint32_t, buf->cap);
+    }
+
+    uint32_t idx = buf->len;
+    buf->len += count;
+    return idx;
+}
+
+static inline uint32_t hash_ptr(const void* ptr, uint32_t cap) {
+
+    // the low bits of a pointer are always the same. The rest is not mixed,
+    // so that nodes that were allocated together in the arena are close
+    // together in the map, which is much faster than a scattered lookup when
+    // the map is larger than the cache.
+    return (uint32_t)((uintptr_t)ptr >> 3) & (cap - 1);
+}
+
+/**
+ * @brief Return the index that was saved for the pointer or zero.
+ *
+ * @param map
+ * @param ptr
+ * @return uint32_t
+ */
+static uint32_t find_ptr_map(PtrMap* map, const void* ptr) {
+
+    if(map->cap == 0)
+        return 0;
+
+    for(uint32_t slot = hash_ptr(ptr, map->cap); map->keys[slot] != NULL; slot = (slot + 1) & (map->cap - 1))
+        if(map->keys[slot] == ptr)
+            return map->vals[slot];
+
+    return 0;
+}
+
+/**
+ * @brief Save the index of a pointer that is not in the map.
+ *
+ * @param map
+ * @param ptr
+ * @param val
+ */
+static void add_ptr_map(PtrMap* map, const void* ptr, uint32_t val) {
+
+    // keep the map at most half full
+    if((map->count + 1) * 2 > map->cap) {
+        PtrMap old = *map;
+        map->cap   = (old.cap == 0) ? 0x400 : old.cap << 1;
+        map->keys  = _ALLOC_ARRAY(const void*, map->cap);
+        map->vals  = _ALLOC_ARRAY(uint32_t, map->cap);
+        map->count = 0;
+
+        for(uint32_t i = 0; i < old.cap; i++)
+            if(old.keys[i] != NULL)
+                add_ptr_map(map, old.keys[i], old.vals[i]);
+
+        _FREE(old.keys);
+        _FREE(old.vals);
+    }
+
+    uint32_t slot = hash_ptr(ptr, map->cap);
+    while(map->keys[slot] != NULL)
+        slot = (slot + 1) & (map->cap - 1);
+
+    map->keys[slot] = ptr;
+    map->vals[slot] = val;
+    map->count++;
+}
+
+/**
+ * @brief Add the string to the text and return its index. The same text is
+ * only stored once.
+ *
+ * @param ps
+ * @param str
+ * @return uint32_t
+ */
+static uint32_t pack_text(PackState* ps, const char* str) {
+
+    if(str == NULL)
+        return 0;
+
+    void* found = find_hashtable(ps->text_map, str);
+    if(found != NULL)
+        return (uint32_t)(uintptr_t)found;
+
+    uint32_t len = (uint32_t)strlen(str) + 1;
+    if(ps->text_len + len > ps->text_cap) {
+        while(ps->text_len + len > ps->text_cap)
+            ps->text_cap <<= 1;
+        ps->text = _REALLOC_ARRAY(ps->text, char, ps->text_cap);
+    }
+
+    uint32_t idx = ps->text_len;
+    memcpy(&ps->text[idx], str, len);
+    ps->text_len += len;
+    insert_hashtable(ps->text_map, str, (void*)(uintptr_t)idx);
+
+    return idx;
+}
+
+static uint32_t pack_token(PackState* ps, Token* tok) {
+
+    if(tok == NULL)
+        return 0;
+
+    uint32_t idx = find_ptr_map(&ps->token_map, tok);
+    if(idx != 0)
+        return idx;
+
+    if(ps->num_tokens + 1 > ps->cap_tokens) {
+        ps->cap_tokens <<= 1;
+        ps->tokens = _REALLOC_ARRAY(ps->tokens, AstPoolToken, ps->cap_tokens);
+    }
+
+    AstPoolToken* pt = &ps->tokens[ps->num_tokens];
+    pt->type         = (uint32_t)tok->type;
+    pt->line_no      = (uint32_t)tok->line_no;
+    pt->col_no       = (uint32_t)tok->col_no;
+    pt->fname        = pack_text(ps, (tok->file_id >= 0) ? get_source_name(tok->file_id) : NULL);
+    pt->text         = pack_text(ps, token_text(tok));
+
+    idx = ps->num_tokens++;
+    add_ptr_map(&ps->token_map, tok, idx);
+
+    return idx;
+}
+
+static uint32_t pack_node(PackState* ps, ast_node* node);
+
+/**
+ * @brief Store a list after everything in it has been stored. The items
+ * are either all nodes or all tokens.
+ *
+ * @param ps
+ * @param list
+ * @return uint32_t
+ */
+static uint32_t pack_list(PackState* ps, AstList* list) {
+
+    if(list == NULL)
+        return 0;
+
+    // the first word of a token is a TokenType, which is less than AST_FIRST
+    bool tokens = (list->len > 0 && ast_node_type(list->items[0]) < AST_FIRST);
+    uint32_t idx = grow_words(&ps->lists, (uint32_t)list->len + 1);
+
+    ps->lists.words[idx] = (uint32_t)list->len | (tokens ? POOL_TOKEN_LIST : 0);
+    for(int i = 0; i < list->len; i++) {
+        // storing an item can grow the list section
+        uint32_t item = tokens ? pack_token(ps, list->items[i]) : pack_node(ps, list->items[i]);
+        ps->lists.words[idx + 1 + i] = item;
+    }
+
+    return idx;
+}
+
+/**
+ * @brief Store a node after all of its children and return its index.
+ *
+ * @param ps
+ * @param node
+ * @return uint32_t
+ */
+static uint32_t pack_node(PackState* ps, ast_node* node) {
+
+    if(node == NULL)
+        return 0;
+
+    uint32_t idx = find_ptr_map(&ps->node_map, node);
+    if(idx != 0)
+        return idx;
+
+    AstType type = ast_node_type(node);
+    if(type < AST_FIRST || type >= AST_LAST || ast_schema[type - AST_FIRST].size == 0)
+        fatal_error("cannot store an AST node of type %d in the pool", type);
+
+    const AstSchema* sch = &ast_schema[type - AST_FIRST];
+    const char* base     = (const char*)node;
+    uint32_t words[POOL_MAX_WORDS];
+    int len = 0;
+
+    if(sch->nfields * 2 > POOL_MAX_WORDS)
+        fatal_error("the %s node has too many fields for the pool", sch->name);
+
+    for(int i = 0; i < sch->nfields; i++) {
+        const void* field = base + sch->fields[i].offset;
+        switch(sch->fields[i].kind) {
+            case POOL_NODE:
+                words[len++] = pack_node(ps, *(ast_node* const*)field);
+                break;
+            case POOL_TOKEN:
+                words[len++] = pack_token(ps, *(Token* const*)field);
+                break;
+            case POOL_LIST:
+                words[len++] = pack_list(ps, *(AstList* const*)field);
+                break;
+            case POOL_STRING: {
+                String* str  = *(String* const*)field;
+                words[len++] = pack_text(ps, (str != NULL) ? raw_string(str) : NULL);
+            } break;
+            case POOL_BOOL:
+                words[len++] = *(const bool*)field;
+                break;
+            case POOL_INT:
+                memcpy(&words[len++], field, sizeof(uint32_t));
+                break;
+            case POOL_QUAD:
+                memcpy(&words[len], field, sizeof(uint64_t));
+                len += 2;
+                break;
+            case POOL_SKIP:
+                break;
+            default:
+                fatal_error("unknown field kind in the schema of %s: %d", sch->name, sch->fields[i].kind);
+        }
+    }
+
+    idx = grow_words(&ps->nodes, (uint32_t)len + 1);
+    ps->nodes.words[idx] = (uint32_t)type;
+    memcpy(&ps->nodes.words[idx + 1], words, sizeof(uint32_t) * len);
+    ps->num_nodes++;
+    add_ptr_map(&ps->node_map, node, idx);
+
+    return idx;
+}
+
+static inline const uint32_t* pool_nodes(const AstPool* pool) {
+
+    return (const uint32_t*)(pool + 1);
+}
+
+static inline const AstPoolToken* pool_tokens(const AstPool* pool) {
+
+    return (const AstPoolToken*)(pool_nodes(pool) + pool->node_words);
+}
+
+static inline const uint32_t* pool_lists(const AstPool* pool) {
+
+    return (const uint32_t*)(pool_tokens(pool) + pool->num_tokens);
+}
+
+static inline const char* pool_text(const AstPool* pool, uint32_t idx) {
+
+    if(idx >= pool->text_size)
+        fatal_error("text index %u is outside of the AST pool", idx);
+
+    return (idx == 0) ? NULL : (const char*)(pool_lists(pool) + pool->list_words) + idx;
+}
+
+/**
+ * @brief Make the tokens of the pool again. A token from a file that is
+ * still loaded refers to it, so that errors can name the file.
+ *
+ * @param pool
+ * @return Token**
+ */
+static Token** expand_tokens(const AstPool* pool) {
+
+    const AstPoolToken* pt = pool_tokens(pool);
+    Token** toks           = _ALLOC_ARRAY(Token*, pool->num_tokens);
+
+    for(uint32_t i = 1; i < pool->num_tokens; i++) {
+        const char* fname = pool_text(pool, pt[i].fname);
+        const char* text  = pool_text(pool, pt[i].text);
+        Token* tok        = _ARENA_ALLOC_T(Token);
+
+        tok->type    = (TokenType)pt[i].type;
+        tok->line_no = (int)pt[i].line_no;
+        tok->col_no  = (int)pt[i].col_no;
+        tok->file_id = (fname != NULL) ? find_source_file(fname) : -1;
+        if(tok->type == TOK_SYMBOL)
+            tok->sym = intern_str(text);
+        else
+            tok->str = create_string(text);
+
+        toks[i] = tok;
+    }
+
+    return toks;
+}
+
+static AstList* expand_list(const AstPool* pool, uint32_t idx, void** nodes, uint32_t max_node, Token** toks) {
+
+    if(idx == 0)
+        return NULL;
+
+    const uint32_t* words = pool_lists(pool);
+    if(idx >= pool->list_words)
+        fatal_error("list index %u is outside of the AST pool", idx);
+
+    uint32_t len = words[idx] & ~POOL_TOKEN_LIST;
+    bool tokens  = (words[idx] & POOL_TOKEN_LIST) != 0;
+    if(idx + len >= pool->list_words)
+        fatal_error("list %u runs past the end of the AST pool", idx);
+
+    AstList* list = _ARENA_ALLOC(sizeof(AstList) + sizeof(void*) * len);
+    list->len     = (int)len;
+
+    for(uint32_t i = 0; i < len; i++) {
+        uint32_t item = words[idx + 1 + i];
+        if(tokens ? (item == 0 || item >= pool->num_tokens) : (item == 0 || item >= max_node || nodes[item] == NULL))
+            fatal_error("list %u has a bad item in the AST pool", idx);
+        list->items[i] = tokens ? (void*)toks[item] : nodes[item];
+    }
+
+    return list;
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Pack the tree of a module into a new pool. The tree is not
+ * changed. Free the pool with destroy_ast_pool().
+ *
+ * @param root
+ * @return AstPool*
+ */
+AstPool* pack_ast(ast_module* root) {
+
+    ENTER;
+    PackState ps;
+    memset(&ps, 0, sizeof(ps));
+
+    // index zero of everything means NULL
+    grow_words(&ps.nodes, 1);
+    grow_words(&ps.lists, 1);
+    ps.nodes.words[0] = 0;
+    ps.lists.words[0] = 0;
+    ps.cap_tokens = 0x400;
+    ps.tokens     = _ALLOC_ARRAY(AstPoolToken, ps.cap_tokens);
+    ps.num_tokens = 1;
+    ps.text_cap   = 0x1000;
+    ps.text       = _ALLOC_ARRAY(char, ps.text_cap);
+    ps.text_len   = 1;
+    ps.text_map   = create_hashtable();
+
+    uint32_t root_idx = pack_node(&ps, (ast_node*)root);
+
+    size_t text_size = (ps.text_len + 3) & ~3u;
+    size_t size      = sizeof(AstPool) + sizeof(uint32_t) * ps.nodes.len +
+            sizeof(AstPoolToken) * ps.num_tokens + sizeof(uint32_t) * ps.lists.len + text_size;
+
+    AstPool* pool   = _ALLOC(size);
+    pool->magic      = AST_POOL_MAGIC;
+    pool->version    = AST_POOL_VERSION;
+    pool->schema     = ast_schema_hash;
+    pool->size       = (uint32_t)size;
+    pool->root       = root_idx;
+    pool->num_nodes  = ps.num_nodes;
+    pool->node_words = ps.nodes.len;
+    pool->num_tokens = ps.num_tokens;
+    pool->list_words = ps.lists.len;
+    pool->text_size  = (uint32_t)text_size;
+
+    char* ptr = (char*)(pool + 1);
+    memcpy(ptr, ps.nodes.words, sizeof(uint32_t) * ps.nodes.len);
+    ptr += sizeof(uint32_t) * ps.nodes.len;
+    memcpy(ptr, ps.tokens, sizeof(AstPoolToken) * ps.num_tokens);
+    ptr += sizeof(AstPoolToken) * ps.num_tokens;
+    memcpy(ptr, ps.lists.words, sizeof(uint32_t) * ps.lists.len);
+    ptr += sizeof(uint32_t) * ps.lists.len;
+    memcpy(ptr, ps.text, ps.text_len);
+
+    TRACE("nodes: %u, tokens: %u, bytes: %u", pool->num_nodes, pool->num_tokens, pool->size);
+
+    _FREE(ps.nodes.words);
+    _FREE(ps.lists.words);
+    _FREE(ps.tokens);
+    _FREE(ps.text);
+    _FREE(ps.node_map.keys);
+    _FREE(ps.node_map.vals);
+    _FREE(ps.token_map.keys);
+    _FREE(ps.token_map.vals);
+    destroy_hashtable(ps.text_map);
+
+    RETV(pool);
+}
+
+/**
+ * @brief Build the tree that is stored in the pool. The nodes are made in
+ * the compile arena, the same as the nodes that the parser makes.
+ *
+ * @param pool
+ * @return ast_module*
+ */
+ast_module* expand_ast_pool(const AstPool* pool) {
+
+    ENTER;
+    const uint32_t* words = pool_nodes(pool);
+    Token** toks          = expand_tokens(pool);
+    void** nodes          = _ALLOC_ARRAY(void*, pool->node_words);
+
+    for(uint32_t idx = 1; idx < pool->node_words;) {
+        AstType type = (AstType)words[idx];
+        if(type < AST_FIRST || type >= AST_LAST || ast_schema[type - AST_FIRST].size == 0)
+            fatal_error("bad node type %d in the AST pool", type);
+
+        const AstSchema* sch = &ast_schema[type - AST_FIRST];
+        ast_node* node       = create_ast_node(type, sch->size);
+        char* base           = (char*)node;
+        uint32_t w           = idx + 1;
+
+        for(int i = 0; i < sch->nfields; i++) {
+            void* field = base + sch->fields[i].offset;
+            if(w >= pool->node_words)
+                fatal_error("node %u runs past the end of the AST pool", idx);
+
+            switch(sch->fields[i].kind) {
+                case POOL_NODE: {
+                    // children are always before their parents
+                    uint32_t child = words[w++];
+                    if(child >= idx || (child != 0 && nodes[child] == NULL))
+                        fatal_error("node %u has a bad child in the AST pool", idx);
+                    *(void**)field = nodes[child];
+                } break;
+                case POOL_TOKEN: {
+                    uint32_t tok = words[w++];
+                    if(tok >= pool->num_tokens)
+                        fatal_error("node %u has a bad token in the AST pool", idx);
+                    *(Token**)field = (tok != 0) ? toks[tok] : NULL;
+                } break;
+                case POOL_LIST:
+                    *(AstList**)field = expand_list(pool, words[w++], nodes, idx, toks);
+                    break;
+                case POOL_STRING: {
+                    const char* str  = pool_text(pool, words[w++]);
+                    *(String**)field = (str != NULL) ? create_string(str) : NULL;
+                } break;
+                case POOL_BOOL:
+                    *(bool*)field = (words[w++] != 0);
+                    break;
+                case POOL_INT:
+                    memcpy(field, &words[w++], sizeof(uint32_t));
+                    break;
+                case POOL_QUAD:
+                    memcpy(field, &words[w], sizeof(uint64_t));
+                    w += 2;
+                    break;
+                case POOL_SKIP:
+                    *(void**)field = NULL;
+                    break;
+                default:
+                    fatal_error("unknown field kind in the schema of %s: %d", sch->name, sch->fields[i].kind);
+            }
+        }
+
+        nodes[idx] = node;
+        idx        = w;
+    }
+
+    if(pool->root == 0 || pool->root >= pool->node_words || nodes[pool->root] == NULL ||
+            ast_node_type(nodes[pool->root]) != AST_module)
+        fatal_error("the root of the AST pool is not a module");
+
+    ast_module* root = nodes[pool->root];
+    _FREE(toks);
+    _FREE(nodes);
+
+    RETV(root);
+}
+
+/**
+ * @brief Traverse the tree that is stored in the pool with the same pass
+ * functions that are used with traverse_ast().
+ *
+ * @param pool
+ * @param pre
+ * @param post
+ */
+void traverse_ast_pool(const AstPool* pool, PassFunc pre, PassFunc post) {
+
+    ENTER;
+    traverse_ast(expand_ast_pool(pool), pre, post);
+    RET;
+}
+
+/**
+ * @brief Check that a block of memory holds a pool that this program can
+ * use, and return it as a pool. Nothing is copied. If the block was written
+ * by a program with different AST structs, or it is not a pool at all, then
+ * NULL is returned.
+ *
+ * @param block
+ * @param size
+ * @return const AstPool*
+ */
+const AstPool* map_ast_pool(const void* block, size_t size) {
+
+    ENTER;
+    const AstPool* pool = block;
+
+    if(size < sizeof(AstPool) || pool->magic != AST_POOL_MAGIC || pool->version != AST_POOL_VERSION ||
+            pool->schema != ast_schema_hash || pool->size != size) {
+        TRACE("not a usable AST pool");
+        RETV(NULL);
+    }
+
+    size_t need = sizeof(AstPool) + sizeof(uint32_t) * ((size_t)pool->node_words + pool->list_words) +
+            sizeof(AstPoolToken) * (size_t)pool->num_tokens + pool->text_size;
+
+    if(need != size || pool->node_words == 0 || pool->num_tokens == 0 || pool->list_words == 0 ||
+            pool->text_size == 0 || ((const char*)pool + size)[-1] != '\0') {
+        TRACE("the sections of the AST pool do not add up");
+        RETV(NULL);
+    }
+
+    RETV(pool);
+}
+
+/**
+ * @brief Read a pool that was written by write_ast_pool() into one block.
+ * Returns NULL if the file cannot be read or does not hold a usable pool.
+ *
+ * @param fname
+ * @return AstPool*
+ */
+AstPool* read_ast_pool(const char* fname) {
+
+    ENTER;
+    struct stat st;
+    FILE* fp = fopen(fname, "rb");
+    if(fp == NULL || fstat(fileno(fp), &st) != 0 || st.st_size < (off_t)sizeof(AstPool)) {
+        if(fp != NULL)
+            fclose(fp);
+        RETV(NULL);
+    }
+
+    AstPool* pool = _ALLOC((size_t)st.st_size);
+    size_t len    = fread(pool, 1, (size_t)st.st_size, fp);
+    fclose(fp);
+
+    if(len != (size_t)st.st_size || map_ast_pool(pool, len) == NULL) {
+        _FREE(pool);
+        RETV(NULL);
+    }
+
+    RETV(pool);
+}
+
+/**
+ * @brief Write the pool to a file exactly as it is in memory.
+ *
+ * @param pool
+ * @param fname
+ */
+void write_ast_pool(const AstPool* pool, const char* fname) {
+
+    ENTER;
+    FILE* fp = fopen(fname, "wb");
+    if(fp == NULL)
+        fatal_error("File Error: cannot open AST pool file: %s", fname);
+
+    if(fwrite(pool, 1, pool->size, fp) != pool->size)
+        fatal_error("File Error: cannot write AST pool file: %s", fname);
+
+    fclose(fp);
+    RET;
+}
+
+/**
+ * @brief Free a pool that was made by pack_ast() or read_ast_pool().
+ *
+ * @param pool
+ */
+void destroy_ast_pool(AstPool* pool) {
+
+    _FREE(pool);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file pool.h
+ *
+ * @brief Public interface to the AST node pool. The pool is a second way
+ * to store the tree of a module, as one block of memory that has no
+ * pointers in it. The nodes refer to each other with 32 bit indexes, so it
+ * is about half the size of the tree and it can be written to a file and
+ * read or mapped back as it is.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef __POOL_H__
+#define __POOL_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ast.h"
+
+/*
+ * How a field of a node struct is stored in the pool.
+ */
+typedef enum {
+    POOL_NODE,   // another node, by index
+    POOL_TOKEN,  // a token, by index
+    POOL_LIST,   // an AstList of nodes or tokens, by index
+    POOL_STRING, // a String, by index in the text
+    POOL_BOOL,   // stored in one word
+    POOL_INT,    // int or an enum, stored in one word
+    POOL_QUAD,   // 64 bits, stored in two words
+    POOL_SKIP,   // not stored, NULL when the tree is built again
+} AstFieldKind;
+
+typedef struct {
+    uint16_t offset;
+    uint16_t kind;
+} AstField;
+
+/*
+ * The fields of the struct of one node type. This table is generated from
+ * the AST headers by mk_schema.py.
+ */
+typedef struct {
+    const char* name;
+    size_t size; // zero if the type has no struct
+    int nfields;
+    const AstField* fields;
+} AstSchema;
+
+extern const AstSchema ast_schema[AST_LAST - AST_FIRST];
+extern const uint32_t ast_schema_hash;
+
+#define AST_POOL_MAGIC 0x5453414b // "KAST"
+#define AST_POOL_VERSION 1
+
+/*
+ * The block starts with this header. The sections follow it in this order
+ * and each one is padded to a word. Index zero of every section is not
+ * used, so that zero is a NULL reference.
+ *
+ *  nodes   - uint32_t words. A node is its type and then its fields in the
+ *            order of the schema. The index of a node is the word where it
+ *            starts. Children are always stored before their parents.
+ *  tokens  - AstPoolToken records.
+ *  lists   - uint32_t words. A list is its length and then the indexes of
+ *            its items. The top bit of the length is set for token lists.
+ *  text    - the zero terminated text of the tokens and the strings.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t schema;     // ast_schema_hash of the program that wrote it
+    uint32_t size;       // bytes in the whole block
+    uint32_t root;       // index of the module node
+    uint32_t num_nodes;  // number of nodes, for reports
+    uint32_t node_words; // size of the node section in words
+    uint32_t num_tokens; // size of the token section in records
+    uint32_t list_words; // size of the list section in words
+    uint32_t text_size;  // size of the text section in bytes
+} AstPool;
+
+typedef struct {
+    uint32_t type;
+    uint32_t line_no;
+    uint32_t col_no;
+    uint32_t fname; // text index of the name of the source file
+    uint32_t text;  // text index of what token_text() returned
+} AstPoolToken;
+
+AstPool* pack_ast(ast_module* root);
+ast_module* expand_ast_pool(const AstPool* pool);
+void traverse_ast_pool(const AstPool* pool, PassFunc pre, PassFunc post);
+const AstPool* map_ast_pool(const void* block, size_t size);
+AstPool* read_ast_pool(const char* fname);
+void write_ast_pool(const AstPool* pool, const char* fname);
+void destroy_ast_pool(AstPool* pool);
+
+#endif /* __POOL_H__ */
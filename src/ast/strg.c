@@ -27,6 +27,7 @@ void traverse_formatted_strg(ast_formatted_strg* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -51,6 +52,7 @@ void traverse_string_literal(ast_string_literal* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
     if(node->literal != NULL)
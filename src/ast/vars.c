@@ -27,6 +27,7 @@ void traverse_var_decl(ast_var_decl* node, PassFunc pre, PassFunc post) {
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -51,14 +52,12 @@ void traverse_var_decl_list(ast_var_decl_list* node, PassFunc pre, PassFunc post
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
-    ast_var_decl* nterm;
-
-    void* mark = NULL;
-    while(NULL != (nterm = iter_link_list(node->list, &mark)))
-        traverse_var_decl(nterm, pre, post);
+    for(int i = 0; i < node->list->len; i++)
+        traverse_var_decl(node->list->items[i], pre, post);
 
     AST_CALLBACK(post, node);
     RET;
@@ -77,6 +76,7 @@ void traverse_var_definition(ast_var_definition* node, PassFunc pre, PassFunc po
 
     assert(node != NULL);
 
+    AST_PRUNE(node);
     ENTER;
     AST_CALLBACK(pre, node);
 
@@ -29,7 +29,7 @@ typedef struct _ast_var_decl_ {
  */
 typedef struct _ast_var_decl_list_ {
     ast_node node;
-    LinkList* list;
+    AstList* list;
 } ast_var_decl_list;
 
 /**
@@ -8,17 +8,83 @@
  * @date 01-13-2024
  * @copyright Copyright (c) 2024
  */
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "errors.h"
 #include "fileio.h"
+#include "memory.h"
 #include "scanner.h"
 #include "trace.h"
 
 #include <stdarg.h>
 
-static int num_errors   = 0;
-static int num_warnings = 0;
+static _Thread_local int num_errors      = 0;
+static _Thread_local int num_warnings    = 0;
+static _Thread_local ErrorLog* error_log = NULL;
+
+/**
+ * @brief Add text that is formatted from a va_list to the end of the log.
+ *
+ * @param log
+ * @param fmt
+ * @param args
+ */
+static void add_error_log(ErrorLog* log, const char* fmt, va_list args) {
+
+    va_list copy;
+    va_copy(copy, args);
+    int len = vsnprintf(NULL, 0, fmt, copy);
+    va_end(copy);
+
+    if(log->len + len + 1 > log->cap) {
+        while(log->len + len + 1 > log->cap)
+            log->cap = (log->cap == 0) ? 0x100 : log->cap << 1;
+        log->text = _REALLOC_ARRAY(log->text, char, log->cap);
+    }
+
+    vsnprintf(&log->text[log->len], len + 1, fmt, args);
+    log->len += len;
+}
+
+/**
+ * @brief Add formatted text to the end of the log.
+ *
+ * @param log
+ * @param fmt
+ * @param ...
+ */
+static void log_printf(ErrorLog* log, const char* fmt, ...) {
+
+    va_list args;
+    va_start(args, fmt);
+    add_error_log(log, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief Print a message, or save it if this thread has a log. A saved
+ * message is a line that starts with the kind, 'E' or 'W'.
+ *
+ * @param kind
+ * @param label
+ * @param fmt
+ * @param args
+ */
+static void report(char kind, const char* label, const char* fmt, va_list args) {
+
+    if(error_log != NULL) {
+        log_printf(error_log, "%c%s: %s: %d: %d: ", kind, label, get_fname(), get_line_no(), get_col_no());
+        add_error_log(error_log, fmt, args);
+        log_printf(error_log, "\n");
+    }
+    else {
+        fprintf(stderr, "%s: %s: %d: %d: ", label, get_fname(), get_line_no(), get_col_no());
+        vfprintf(stderr, fmt, args);
+        fputc('\n', stderr);
+    }
+}
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wimplicit-function-declaration"
@@ -112,12 +178,9 @@ void show_syntax(const char* fmt, ...) {
 
     va_list args;
 
-    fprintf(stderr, "Syntax: %s: %d: %d: ", get_fname(), get_line_no(), get_col_no());
-
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    report('E', "Syntax", fmt, args);
     va_end(args);
-    fputc('\n', stderr);
     num_errors++;
     recover_error();
 }
@@ -133,12 +196,9 @@ void show_warning(const char* fmt, ...) {
 
     va_list args;
 
-    fprintf(stderr, "Warning: %s: %d: %d: ", get_fname(), get_line_no(), get_col_no());
-
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    report('W', "Warning", fmt, args);
     va_end(args);
-    fputc('\n', stderr);
     num_warnings++;
 }
 
@@ -163,3 +223,82 @@ int get_num_warnings(void) {
 
     return num_warnings;
 }
+
+/**
+ * @brief Save the syntax errors and warnings of this thread in a log
+ * instead of printing them, so that they can be printed later by another
+ * thread in the order that a serial compile would print them.
+ *
+ */
+void start_error_log(void) {
+
+    if(error_log == NULL)
+        error_log = _ALLOC_T(ErrorLog);
+}
+
+/**
+ * @brief Stop saving the messages of this thread and return the log.
+ *
+ * @return ErrorLog*
+ *
+ */
+ErrorLog* finish_error_log(void) {
+
+    ErrorLog* log = error_log;
+    error_log     = NULL;
+    return log;
+}
+
+/**
+ * @brief Return where the log of this thread is now, to replay part of it.
+ *
+ * @return size_t
+ *
+ */
+size_t mark_error_log(void) {
+
+    return (error_log != NULL) ? error_log->len : 0;
+}
+
+/**
+ * @brief Print the messages in part of a log and count them as if this
+ * thread had reported them.
+ *
+ * @param log
+ * @param from
+ * @param to
+ *
+ */
+void replay_error_log(const ErrorLog* log, size_t from, size_t to) {
+
+    if(log == NULL)
+        return;
+
+    while(from < to) {
+        const char* line = &log->text[from];
+        const char* end  = memchr(line, '\n', to - from);
+        size_t len       = (end != NULL) ? (size_t)(end - line) + 1 : to - from;
+
+        if(line[0] == 'E')
+            num_errors++;
+        else
+            num_warnings++;
+
+        fwrite(&line[1], 1, len - 1, stderr);
+        from += len;
+    }
+}
+
+/**
+ * @brief Free a log.
+ *
+ * @param log
+ *
+ */
+void destroy_error_log(ErrorLog* log) {
+
+    if(log != NULL) {
+        _FREE(log->text);
+        _FREE(log);
+    }
+}
@@ -11,12 +11,30 @@
 #ifndef _ERRORS_H_
 #define _ERRORS_H_
 
+#include <stddef.h>
+
+/*
+ * The messages that a thread saved instead of printing. Each message is a
+ * line that starts with 'E' for an error or 'W' for a warning.
+ */
+typedef struct {
+    char* text;
+    size_t len;
+    size_t cap;
+} ErrorLog;
+
 void show_syntax(const char* fmt, ...);
 void show_warning(const char* fmt, ...);
 void fatal_error(const char* fmt, ...);
 int get_num_errors(void);
 int get_num_warnings(void);
 
+void start_error_log(void);
+ErrorLog* finish_error_log(void);
+size_t mark_error_log(void);
+void replay_error_log(const ErrorLog* log, size_t from, size_t to);
+void destroy_error_log(ErrorLog* log);
+
 #define EXPECTED(s)                                                          \
     do {                                                                     \
         show_syntax("expected %s but got %s", (s), tok_to_str(get_token())); \
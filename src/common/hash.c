@@ -1,16 +1,24 @@
 /**
  * @file hash.c
  *
- * @brief This is a very simple open-addressing hash table. When a hash
- * collision happens, the next items are checked one at a time for a free
- * slot. When the table is 3/4 full, then it is resized and the table is
- * re-hashed. When a table entry is deleted, then the key is freed, making
- * the slot available for use. The size of the table is never reduced. A
- * single pointer is stored as the node payload and that pointer is never
- * written or freed. The payload is what gets returned when the find method
- * is called.
+ * @brief This is an open-addressing hash table that uses Robin Hood
+ * probing. When a hash collision happens, the next items are checked one at
+ * a time, and a new entry takes the slot of any entry that is closer to its
+ * own home slot than the new one is. That keeps every probe short, and a
+ * search can stop as soon as it reaches an entry that is closer to home than
+ * the key would be. When the table is 3/4 full, or a probe gets too long,
+ * then it is resized and the table is re-hashed. The size of the table is
+ * never reduced.
+ *
+ * The full hash of the key is kept in the node, so the table is re-hashed
+ * without looking at the keys, and strcmp() is only called when the hashes
+ * match. When a node is deleted, the key is freed and the nodes after it are
+ * shifted back one slot, so there are no tombstones. A single pointer is
+ * stored as the node payload and that pointer is never written or freed. The
+ * payload is what gets returned when the find method is called.
  *
  *  https://programming.guide/hash-tables-open-addressing.html
+ *  https://programming.guide/robin-hood-hashing.html
  *
  * @author Chuck Tilbury (chucktilbury@gmail.com)
  * @version 0.0
@@ -27,19 +35,22 @@
 #include "memory.h"
 #include "symbols.h"
 
+// a probe that is this long makes the table grow if it is not nearly empty
+#define HASH_MAX_PROBE 32
+
 /**
  * @brief Simple hash function. Do not mess around with the constant values.
+ * This is the same hash that the intern pool uses.
  *
  * @param key
  * @return uint32_t
  */
-static uint32_t hash_func(const char* key) {
+static inline uint32_t hash_func(const char* key) {
 
     uint32_t hash = 2166136261u;
-    int slen      = strlen(key);
 
-    for(int i = 0; i < slen; i++) {
-        hash ^= (uint8_t)key[i];
+    for(const char* ptr = key; *ptr != '\0'; ptr++) {
+        hash ^= (uint8_t)*ptr;
         hash *= 16777619;
     }
 
@@ -47,56 +58,100 @@ static uint32_t hash_func(const char* key) {
 }
 
 /**
- * @brief Find the slot in the has table accounting for tombstones and
- * collisions. If ts is set, then the has was deleted and open for a new
- * entry. If the key is NULL, then the node is unallocated.
+ * @brief Return how far the slot is from the home slot of the hash.
  *
  * @param tab
- * @param key
+ * @param slot
+ * @param hash
  * @return int
  */
-static int find_slot(HashTable* tab, const char* key) {
+static inline int probe_dist(const HashTable* tab, uint32_t slot, uint32_t hash) {
 
-    uint32_t hash = hash_func(key) & (tab->cap - 1);
-    for(int i = 0; i < tab->cap; i++) {
-        if(tab->table[hash].key == NULL)
-            return hash;
-        else if(strcmp(tab->table[hash].key, key) == 0)
-            return hash; // found key
-        else
-            hash = (hash + 1) & (tab->cap - 1);
-    }
+    return (int)((slot - hash) & (tab->cap - 1));
+}
 
-    return -1; // should never happen
+/**
+ * @brief Find the slot that holds the key. The search stops at an empty
+ * slot or at a node that is closer to its home than the key would be,
+ * because the key would have taken that slot.
+ *
+ * @param tab
+ * @param key
+ * @param hash
+ * @return int the slot or -1 if the key is not in the table
+ */
+static int find_slot(const HashTable* tab, const char* key, uint32_t hash) {
+
+    uint32_t mask = tab->cap - 1;
+    uint32_t slot = hash & mask;
+
+    for(int dist = 0;; dist++) {
+        const HashNode* node = &tab->table[slot];
+        if(node->key == NULL || probe_dist(tab, slot, node->hash) < dist)
+            return -1;
+        if(node->hash == hash && strcmp(node->key, key) == 0)
+            return slot;
+        slot = (slot + 1) & mask;
+    }
 }
 
 /**
- * @brief If the table needs to be expanded, then this function will allocate
- * the memory and place all of the entries into the new table.
+ * @brief Place a node that is not in the table, starting at a slot that is
+ * dist from its home. Each node that is closer to its home than the one that
+ * is being placed is taken out and placed further on.
  *
  * @param tab
+ * @param node
+ * @param slot
+ * @param dist
+ * @return bool true if a probe got too long
  */
-static void rehash_table(HashTable* tab) {
-
-    if(tab->count * 1.75 > tab->cap) {
-        int oldcap       = tab->cap;
-        HashNode* oldtab = tab->table;
-        tab->cap <<= 1; // double the capacity
-        tab->table = _ALLOC_ARRAY(HashNode, tab->cap);
-        for(int i = 0; i < tab->cap; i++)
-            memset(&tab->table[i], 0, sizeof(HashNode));
-
-        int slot;
-        for(int i = 0; i < oldcap; i++) {
-            if(oldtab[i].key != NULL) {
-                slot = find_slot(tab, oldtab[i].key);
-                // printf("rehash slot: %d: %s\n", slot, oldtab[i].key);
-                tab->table[slot].key  = oldtab[i].key;
-                tab->table[slot].data = oldtab[i].data;
-            }
+static bool place_node(HashTable* tab, HashNode node, uint32_t slot, int dist) {
+
+    uint32_t mask = tab->cap - 1;
+    bool too_long = false;
+
+    for(;; dist++) {
+        HashNode* crnt = &tab->table[slot];
+        if(crnt->key == NULL) {
+            *crnt = node;
+            return too_long;
+        }
+
+        int crnt_dist = probe_dist(tab, slot, crnt->hash);
+        if(crnt_dist < dist) {
+            HashNode tmp = *crnt;
+            *crnt        = node;
+            node         = tmp;
+            dist         = crnt_dist;
         }
-        _FREE(oldtab);
+
+        if(dist >= HASH_MAX_PROBE)
+            too_long = true;
+        slot = (slot + 1) & mask;
+    }
+}
+
+/**
+ * @brief Allocate a table with the new capacity and place all of the
+ * entries into it. The stored hashes are used, so no key is looked at.
+ *
+ * @param tab
+ * @param cap
+ */
+static void resize_table(HashTable* tab, int cap) {
+
+    int oldcap       = tab->cap;
+    HashNode* oldtab = tab->table;
+
+    tab->cap   = cap;
+    tab->table = _ALLOC_ARRAY(HashNode, tab->cap);
+
+    for(int i = 0; i < oldcap; i++) {
+        if(oldtab[i].key != NULL)
+            place_node(tab, oldtab[i], oldtab[i].hash & (tab->cap - 1), 0);
     }
+    _FREE(oldtab);
 }
 
 /**
@@ -112,7 +167,8 @@ void dump_hash_table(HashTable* tab) {
     printf("count: %d\n", tab->count);
     for(int i = 0; i < tab->cap; i++) {
         if(tab->table[i].key != NULL) {
-            printf("(%d) key: %s\n", i, tab->table[i].key);
+            printf("(%d) dist: %d key: %s\n", i, probe_dist(tab, i, tab->table[i].hash),
+                   tab->table[i].key);
         }
     }
     printf("\n");
@@ -133,10 +189,7 @@ HashTable* create_hashtable(void) {
 
     tab->count = 0;
     tab->cap   = 0x01 << 3;
-
     tab->table = _ALLOC_ARRAY(HashNode, tab->cap);
-    for(int i = 0; i < tab->cap; i++)
-        memset(&tab->table[i], 0, sizeof(HashNode));
 
     return tab;
 }
@@ -151,10 +204,8 @@ void destroy_hashtable(HashTable* table) {
     if(table != NULL) {
         // table being NULL is not an error
         for(int i = 0; i < table->cap; i++) {
-            if(table->table[i].data != NULL) {
-                if(table->table[i].key != NULL) {
-                    _FREE(table->table[i].key);
-                }
+            if(table->table[i].key != NULL) {
+                _FREE(table->table[i].key);
             }
         }
 
@@ -169,7 +220,6 @@ void destroy_hashtable(HashTable* table) {
  * @param table
  * @param key
  * @param data
- * @param size
  * @return HashResult
  */
 HashResult insert_hashtable(HashTable* table, const char* key, void* node) {
@@ -178,19 +228,31 @@ HashResult insert_hashtable(HashTable* table, const char* key, void* node) {
     assert(node != NULL);
     assert(key != NULL);
 
-    rehash_table(table);
-    int slot = find_slot(table, key);
-    // printf("insert slot: %d: %s\n", slot, key);
-    assert(slot >= 0);
-
-    if(table->table[slot].key != NULL)
-        return HASH_DUP;
-    else {
-        table->table[slot].key  = _DUP_STR(key);
-        table->table[slot].data = node;
-        table->count++;
+    if((table->count + 1) * 4 > table->cap * 3)
+        resize_table(table, table->cap << 1);
+
+    uint32_t hash = hash_func(key);
+    uint32_t mask = table->cap - 1;
+    uint32_t slot = hash & mask;
+    int dist      = 0;
+
+    // look for the key until the slot where it would be
+    for(;; dist++) {
+        HashNode* crnt = &table->table[slot];
+        if(crnt->key == NULL || probe_dist(table, slot, crnt->hash) < dist)
+            break;
+        if(crnt->hash == hash && strcmp(crnt->key, key) == 0)
+            return HASH_DUP;
+        slot = (slot + 1) & mask;
     }
 
+    HashNode new_node = {.key = _DUP_STR(key), .data = node, .hash = hash};
+    table->count++;
+
+    // a long probe with a sparse table means that the hashes are bad
+    if(place_node(table, new_node, slot, dist) && table->count * 4 > table->cap)
+        resize_table(table, table->cap << 1);
+
     return HASH_OK;
 }
 
@@ -199,28 +261,21 @@ HashResult insert_hashtable(HashTable* table, const char* key, void* node) {
  *
  * @param tab
  * @param key
- * @param data
- * @return HashResult
+ * @return void*
  */
 void* find_hashtable(HashTable* tab, const char* key) {
 
     assert(tab != NULL);
     assert(key != NULL);
 
-    int slot = find_slot(tab, key);
-
-    // printf("find slot: %d: %s\n", slot, key);
-    if(tab->table[slot].key != NULL) {
-        if(strcmp(tab->table[slot].key, key) == 0) {
-            return tab->table[slot].data;
-        }
-    }
+    int slot = find_slot(tab, key, hash_func(key));
 
-    return NULL;
+    return (slot >= 0) ? tab->table[slot].data : NULL;
 }
 
 /**
- * @brief Remove a node from the table based on the key.
+ * @brief Remove a node from the table based on the key. The nodes after it
+ * that are not in their home slot are shifted back to close the gap.
  *
  * @param tab
  * @param key
@@ -231,17 +286,66 @@ HashResult remove_hashtable(HashTable* tab, const char* key) {
     assert(tab != NULL);
     assert(key != NULL);
 
-    int slot = find_slot(tab, key);
-    // printf("remove slot: %d: %s\n", slot, key);
+    int found = find_slot(tab, key, hash_func(key));
+    if(found < 0)
+        return HASH_NF;
 
-    if(tab->table[slot].key != NULL) {
-        if(strcmp(tab->table[slot].key, key) == 0) {
-            _FREE(tab->table[slot].key);
-            tab->table[slot].key = NULL;
-            tab->count--;
-            return HASH_OK;
-        }
+    uint32_t mask = tab->cap - 1;
+    uint32_t slot = (uint32_t)found;
+    uint32_t next = (slot + 1) & mask;
+
+    _FREE(tab->table[slot].key);
+    while(tab->table[next].key != NULL && probe_dist(tab, next, tab->table[next].hash) > 0) {
+        tab->table[slot] = tab->table[next];
+        slot             = next;
+        next             = (next + 1) & mask;
+    }
+    memset(&tab->table[slot], 0, sizeof(HashNode));
+    tab->count--;
+
+    return HASH_OK;
+}
+
+/**
+ * @brief Make the table large enough to hold count entries without being
+ * re-hashed.
+ *
+ * @param tab
+ * @param count
+ */
+void reserve_hashtable(HashTable* tab, int count) {
+
+    assert(tab != NULL);
+
+    int cap = tab->cap;
+    while(count * 4 > cap * 3)
+        cap <<= 1;
+
+    if(cap > tab->cap)
+        resize_table(tab, cap);
+}
+
+/**
+ * @brief Insert a number of keys with their data. The table is sized for
+ * all of them first. A key that is already in the table keeps its data.
+ *
+ * @param tab
+ * @param keys
+ * @param data
+ * @param count
+ * @return HashResult HASH_DUP if any of the keys was already there
+ */
+HashResult insert_hashtable_bulk(HashTable* tab, const char** keys, void** data, int count) {
+
+    assert(tab != NULL);
+
+    HashResult result = HASH_OK;
+
+    reserve_hashtable(tab, tab->count + count);
+    for(int i = 0; i < count; i++) {
+        if(insert_hashtable(tab, keys[i], data[i]) == HASH_DUP)
+            result = HASH_DUP;
     }
 
-    return HASH_NF;
+    return result;
 }
@@ -13,6 +13,7 @@
 #define _HASH_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 /*
@@ -21,11 +22,12 @@
 typedef struct {
     const char* key;
     void* data;
+    uint32_t hash; // full hash of the key
 } HashNode;
 
 /*
- * If a node's key is NULL, but the bucket pointer in the table
- * is not NULL, then the bucket is a tombstone.
+ * A node with a NULL key is empty. There are no tombstones. The distance of
+ * a node from its home slot is (slot - hash) & (cap - 1).
  */
 typedef struct {
     HashNode* table;
@@ -44,5 +46,7 @@ void destroy_hashtable(HashTable* table);
 HashResult insert_hashtable(HashTable* table, const char* key, void* data);
 void* find_hashtable(HashTable* tab, const char* key);
 HashResult remove_hashtable(HashTable* tab, const char* key);
+void reserve_hashtable(HashTable* tab, int count);
+HashResult insert_hashtable_bulk(HashTable* tab, const char** keys, void** data, int count);
 
 #endif /* _HASH_H_ */
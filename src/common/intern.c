@@ -0,0 +1,331 @@
+/**
+ * @file intern.c
+ *
+ * @brief This is the interning pool for names. Every distinct identifier is
+ * stored exactly once and is given a 32 bit ID. The IDs are indexes into an
+ * array of entries, so going from an ID to the text is a single array
+ * reference and comparing two names is an integer compare. The text of the
+ * names is packed into large blocks that are never moved or freed, so the
+ * pointer that is returned for an ID is good for the whole compile.
+ *
+ * The lookup index is an open addressing table of IDs. The full hash is kept
+ * in the entry so that probing only calls memcmp() when the hash and the
+ * length both match. Nothing is ever removed from the pool.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <assert.h>
+#include <string.h>
+
+#include "intern.h"
+#include "memory.h"
+
+// size of the blocks that the text of the names is packed into
+#define INTERN_BLOCK (0x01 << 16)
+
+typedef struct {
+    const char* str;
+    uint32_t hash;
+    int len;
+} _intern_entry;
+
+static _Thread_local _intern_entry* _entries = NULL;
+static _Thread_local int _count              = 0;
+static _Thread_local int _cap                = 0;
+
+// slots hold an ID or zero for an empty slot
+static _Thread_local SymId* _slots = NULL;
+static _Thread_local int _slot_cap = 0;
+
+static _Thread_local char* _block       = NULL;
+static _Thread_local size_t _block_left = 0;
+
+// the IDs that were asked for since start_intern_log(), each one once
+static _Thread_local SymId* _log        = NULL;
+static _Thread_local int _log_len       = 0;
+static _Thread_local int _log_cap       = 0;
+static _Thread_local bool _logging      = false;
+static _Thread_local uint32_t* _log_gen = NULL;
+static _Thread_local int _log_gen_cap   = 0;
+static _Thread_local uint32_t _gen      = 0;
+
+/**
+ * @brief Same FNV-1a hash as the hash table, but over a buffer with a
+ * length so that the names can be hashed where they sit in the source.
+ *
+ * @param buf
+ * @param len
+ * @return uint32_t
+ */
+static inline uint32_t hash_buf(const char* buf, size_t len) {
+
+    uint32_t hash = 2166136261u;
+
+    for(size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)buf[i];
+        hash *= 16777619;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Copy the text of a new name into the current block and terminate
+ * it. Names that are larger than a block get their own allocation.
+ *
+ * @param buf
+ * @param len
+ * @return const char*
+ */
+static const char* save_text(const char* buf, size_t len) {
+
+    char* ptr;
+
+    if(len + 1 > INTERN_BLOCK)
+        ptr = _ALLOC(len + 1);
+    else {
+        if(len + 1 > _block_left) {
+            _block      = _ALLOC(INTERN_BLOCK);
+            _block_left = INTERN_BLOCK;
+        }
+        ptr = _block;
+        _block += len + 1;
+        _block_left -= len + 1;
+    }
+
+    memcpy(ptr, buf, len);
+    ptr[len] = '\0';
+
+    return ptr;
+}
+
+/**
+ * @brief Place all of the IDs into a new index that is twice as large.
+ */
+static void grow_slots(void) {
+
+    _FREE(_slots);
+    _slot_cap <<= 1;
+    _slots = _ALLOC_ARRAY(SymId, _slot_cap);
+
+    for(int id = 1; id < _count; id++) {
+        uint32_t slot = _entries[id].hash & (_slot_cap - 1);
+        while(_slots[slot] != SYMID_NONE)
+            slot = (slot + 1) & (_slot_cap - 1);
+        _slots[slot] = (SymId)id;
+    }
+}
+
+/**
+ * @brief Add an ID to the log if it is not in it yet. The generation of an
+ * ID says which log it was last added to, so nothing is cleared between
+ * logs.
+ *
+ * @param id
+ */
+static void log_id(SymId id) {
+
+    if((int)id >= _log_gen_cap) {
+        int cap = (_log_gen_cap == 0) ? 0x400 : _log_gen_cap;
+        while((int)id >= cap)
+            cap <<= 1;
+        _log_gen = _REALLOC_ARRAY(_log_gen, uint32_t, cap);
+        memset(&_log_gen[_log_gen_cap], 0, sizeof(uint32_t) * (cap - _log_gen_cap));
+        _log_gen_cap = cap;
+    }
+
+    if(_log_gen[id] == _gen)
+        return;
+    _log_gen[id] = _gen;
+
+    if(_log_len + 1 > _log_cap) {
+        _log_cap = (_log_cap == 0) ? 0x400 : _log_cap << 1;
+        _log     = _REALLOC_ARRAY(_log, SymId, _log_cap);
+    }
+    _log[_log_len++] = id;
+}
+
+/**
+ * @brief Set up the pool on first use. Entry zero is the empty string.
+ */
+static void init_intern(void) {
+
+    _cap     = 0x01 << 10;
+    _entries = _ALLOC_ARRAY(_intern_entry, _cap);
+
+    _slot_cap = 0x01 << 11;
+    _slots    = _ALLOC_ARRAY(SymId, _slot_cap);
+
+    _entries[0].str  = "";
+    _entries[0].hash = hash_buf("", 0);
+    _entries[0].len  = 0;
+    _count           = 1;
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Return the ID of the name that is in the buffer, adding it to the
+ * pool if it has not been seen before. The buffer does not need to be
+ * terminated.
+ *
+ * @param buf
+ * @param len
+ * @return SymId
+ */
+SymId intern_buf(const char* buf, size_t len) {
+
+    if(_entries == NULL)
+        init_intern();
+
+    if(len == 0)
+        return SYMID_NONE;
+
+    assert(buf != NULL);
+
+    uint32_t hash = hash_buf(buf, len);
+    uint32_t slot = hash & (_slot_cap - 1);
+    SymId id;
+
+    while((id = _slots[slot]) != SYMID_NONE) {
+        _intern_entry* ent = &_entries[id];
+        if(ent->hash == hash && (size_t)ent->len == len && memcmp(ent->str, buf, len) == 0) {
+            if(_logging)
+                log_id(id);
+            return id;
+        }
+        slot = (slot + 1) & (_slot_cap - 1);
+    }
+
+    // not found, so add it where the search stopped
+    if(_count + 1 >= _cap) {
+        _cap <<= 1;
+        _entries = _REALLOC_ARRAY(_entries, _intern_entry, _cap);
+    }
+
+    id                 = (SymId)_count++;
+    _entries[id].str   = save_text(buf, len);
+    _entries[id].hash  = hash;
+    _entries[id].len   = (int)len;
+    _slots[slot]       = id;
+
+    // keep the index at most half full
+    if(_count * 2 > _slot_cap)
+        grow_slots();
+
+    if(_logging)
+        log_id(id);
+    return id;
+}
+
+/**
+ * @brief Return the ID of a zero terminated string.
+ *
+ * @param str
+ * @return SymId
+ */
+SymId intern_str(const char* str) {
+
+    return (str != NULL) ? intern_buf(str, strlen(str)) : SYMID_NONE;
+}
+
+/**
+ * @brief Return the canonical text of the ID. The pointer is good for the
+ * whole compile.
+ *
+ * @param id
+ * @return const char*
+ */
+const char* interned_str(SymId id) {
+
+    if(_entries == NULL)
+        init_intern();
+
+    assert(id < (SymId)_count);
+    return _entries[id].str;
+}
+
+/**
+ * @brief Return the length of the text of the ID.
+ *
+ * @param id
+ * @return int
+ */
+int interned_len(SymId id) {
+
+    if(_entries == NULL)
+        init_intern();
+
+    assert(id < (SymId)_count);
+    return _entries[id].len;
+}
+
+/**
+ * @brief Return the hash of the text of the ID. This is the same value that
+ * the hash table would calculate for the string.
+ *
+ * @param id
+ * @return uint32_t
+ */
+uint32_t interned_hash(SymId id) {
+
+    if(_entries == NULL)
+        init_intern();
+
+    assert(id < (SymId)_count);
+    return _entries[id].hash;
+}
+
+/**
+ * @brief Return the number of IDs that have been given out, including the
+ * empty string. Every ID is less than this.
+ *
+ * @return int
+ */
+int intern_count(void) {
+
+    return (_entries == NULL) ? 1 : _count;
+}
+
+/**
+ * @brief Start a log of the names that this thread asks for. Each name is
+ * in it once, in the order that it was first asked for. Another thread
+ * that interns the names in that order gives them IDs in the same order as
+ * if it had asked for them itself.
+ *
+ */
+void start_intern_log(void) {
+
+    _logging = true;
+    _log_len = 0;
+    _gen++;
+}
+
+/**
+ * @brief Return the number of names in the log now.
+ *
+ * @return int
+ */
+int mark_intern_log(void) {
+
+    return _logging ? _log_len : 0;
+}
+
+/**
+ * @brief Stop the log and return it. It is good until the next log is
+ * started.
+ *
+ * @param count
+ * @return const SymId*
+ */
+const SymId* finish_intern_log(int* count) {
+
+    _logging = false;
+    *count   = _log_len;
+    return _log;
+}
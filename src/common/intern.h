@@ -0,0 +1,39 @@
+/**
+ * @file intern.h
+ *
+ * @brief Public interface to the identifier interning pool. Every distinct
+ * name gets a single canonical copy of its text and a small integer ID that
+ * stays the same for the whole compile.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _INTERN_H_
+#define _INTERN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * IDs are handed out in order starting at 1. Zero is the empty string, so
+ * a zeroed data structure holds a valid "no name" ID.
+ */
+typedef uint32_t SymId;
+
+#define SYMID_NONE ((SymId)0)
+
+SymId intern_buf(const char* buf, size_t len);
+SymId intern_str(const char* str);
+const char* interned_str(SymId id);
+int interned_len(SymId id);
+uint32_t interned_hash(SymId id);
+int intern_count(void);
+
+void start_intern_log(void);
+int mark_intern_log(void);
+const SymId* finish_intern_log(int* count);
+
+#endif /* _INTERN_H_ */
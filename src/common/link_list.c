@@ -24,7 +24,7 @@
  */
 LinkList* create_link_list(void) {
 
-    LinkList* lst   = _ALLOC_T(LinkList);
+    LinkList* lst   = _ARENA_ALLOC_T(LinkList);
     lst->first      = NULL;
     lst->last       = NULL;
     lst->is_changed = true;
@@ -56,7 +56,7 @@ void append_link_list(LinkList* lst, void* data) {
     assert(lst != NULL);
     assert(data != NULL);
 
-    LinkListElem* elem = _ALLOC_T(LinkListElem);
+    LinkListElem* elem = _ARENA_ALLOC_T(LinkListElem);
     elem->data         = data;
 
     if(lst->last == NULL)
@@ -81,7 +81,7 @@ void prepend_link_list(LinkList* lst, void* data) {
     assert(lst != NULL);
     assert(data != NULL);
 
-    LinkListElem* elem = _ALLOC_T(LinkListElem);
+    LinkListElem* elem = _ARENA_ALLOC_T(LinkListElem);
     elem->data         = data;
 
     if(lst->first == NULL)
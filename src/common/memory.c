@@ -15,6 +15,7 @@
 #include <string.h>
 
 #include "errors.h"
+#include "memory.h"
 
 #ifdef USE_GC
 #include <gc.h>
@@ -122,6 +123,150 @@ char* mem_fdup_str(const char* str, ...) {
     return buffer;
 }
 
+/******************************************************************************
+ * ARENA
+ *
+ * The chunks are allocated with calloc(), so the memory that is given out
+ * does not need to be cleared one object at a time. Large chunks come from
+ * the kernel already zeroed.
+ */
+
+// used when the arena does not give a chunk size
+#define ARENA_CHUNK (0x01 << 20)
+
+struct _arena_chunk_ {
+    ArenaChunk* next;
+    size_t size;    // usable bytes after the header
+    char data[];
+};
+
+// AST nodes, the lists in them, and the parser's scratch data. Every thread
+// that compiles has its own.
+_Thread_local Arena compile_arena;
+
+/**
+ * @brief Get a new chunk of zeroed memory.
+ *
+ * @param size
+ * @return ArenaChunk*
+ *
+ */
+static ArenaChunk* new_chunk(size_t size) {
+
+#ifdef USE_GC
+    // the GC has to see the pointers that are stored in the arena
+    ArenaChunk* chunk = GC_malloc(sizeof(ArenaChunk) + size);
+#else
+    ArenaChunk* chunk = calloc(1, sizeof(ArenaChunk) + size);
+#endif
+    if(chunk == NULL)
+        fatal_error("MEMORY: Cannot allocate an arena chunk of %lu bytes\n", size);
+
+    chunk->size = size;
+    return chunk;
+}
+
+/**
+ * @brief Called by arena_alloc() when the current chunk does not have room.
+ * An allocation that is larger than a chunk gets a chunk of its own, which
+ * is placed after the current one so that what is left of the current one
+ * is not lost.
+ *
+ * @param arena
+ * @param size
+ * @return void*
+ *
+ */
+void* arena_grow(Arena* arena, size_t size) {
+
+    size_t chunk_size = (arena->chunk_size != 0) ? arena->chunk_size : ARENA_CHUNK;
+    ArenaChunk* chunk;
+
+    arena->total += size;
+    if(size > chunk_size / 4 && arena->chunks != NULL) {
+        chunk = new_chunk(size);
+        chunk->next = arena->chunks->next;
+        arena->chunks->next = chunk;
+        return chunk->data;
+    }
+
+    chunk = new_chunk((size > chunk_size) ? size : chunk_size);
+    chunk->next   = arena->chunks;
+    arena->chunks = chunk;
+    arena->next   = chunk->data + size;
+    arena->end    = chunk->data + chunk->size;
+
+    return chunk->data;
+}
+
+/**
+ * @brief Give back everything that was allocated from the arena. The first
+ * chunk that was allocated is kept and cleared so the arena can be used
+ * again without going back to the system.
+ *
+ * @param arena
+ *
+ */
+void reset_arena(Arena* arena) {
+
+    ArenaChunk* keep = NULL;
+    ArenaChunk* next;
+
+    for(ArenaChunk* chunk = arena->chunks; chunk != NULL; chunk = next) {
+        next = chunk->next;
+        if(next == NULL)
+            keep = chunk;
+        else
+            mem_free(chunk);
+    }
+
+    if(keep != NULL) {
+        memset(keep->data, 0, keep->size);
+        keep->next  = NULL;
+        arena->next = keep->data;
+        arena->end  = keep->data + keep->size;
+    }
+    else
+        arena->next = arena->end = NULL;
+
+    arena->chunks = keep;
+    arena->total  = 0;
+}
+
+/**
+ * @brief Free all of the memory that the arena holds. The arena can still
+ * be used after this.
+ *
+ * @param arena
+ *
+ */
+void destroy_arena(Arena* arena) {
+
+    ArenaChunk* next;
+
+    for(ArenaChunk* chunk = arena->chunks; chunk != NULL; chunk = next) {
+        next = chunk->next;
+        mem_free(chunk);
+    }
+
+    arena->chunks = NULL;
+    arena->next   = NULL;
+    arena->end    = NULL;
+    arena->total  = 0;
+}
+
+/**
+ * @brief Free the arena that holds the AST. This has the signature that
+ * atexit() wants, because the trace stack is in the arena and the trace is
+ * used until main() returns. That only frees the arena of the main thread.
+ * Any other thread that compiles calls this before it returns.
+ *
+ */
+void destroy_compile_arena(void) {
+
+    destroy_arena(&compile_arena);
+}
+
 /**
  * @brief Free memory. This is a no-op when using GC.
  *
@@ -11,6 +11,7 @@
 #ifndef _MEMORY_H_
 #define _MEMORY_H_
 
+#include <stddef.h>
 #include <stdlib.h>
 
 #define _ALLOC(s) mem_alloc(s)
@@ -26,6 +27,12 @@
 #define _FDUP_STR(p, ...) mem_fdup_str(p __VA_OPT__(, ) __VA_ARGS__)
 #define _FREE(p) mem_free(((void*)p))
 
+// Allocations that live as long as the compile. They are never freed one at
+// a time.
+#define _ARENA_ALLOC(s) arena_alloc(&compile_arena, (s))
+#define _ARENA_ALLOC_T(t) (t*)arena_alloc(&compile_arena, sizeof(t))
+#define _ARENA_ALLOC_ARRAY(t, n) (t*)arena_alloc(&compile_arena, sizeof(t) * (n))
+
 void* mem_alloc(size_t size);
 void* mem_realloc(void* ptr, size_t size);
 void* mem_dup(void* ptr, size_t size);
@@ -33,4 +40,47 @@ char* mem_dup_str(const char* str);
 char* mem_fdup_str(const char* str, ...);
 void mem_free(void* ptr);
 
+/*
+ * A region of memory that is given out by moving a pointer. Memory that
+ * comes from an arena is already zeroed and is freed all at once when the
+ * arena is reset or destroyed. A zeroed Arena is ready to use.
+ */
+typedef struct _arena_chunk_ ArenaChunk;
+
+typedef struct {
+    char* next;         // next free byte in the current chunk
+    char* end;          // end of the current chunk
+    ArenaChunk* chunks; // all of the chunks, the current one first
+    size_t chunk_size;  // size of a new chunk, zero for the default
+    size_t total;       // number of bytes that have been given out
+} Arena;
+
+#define ARENA_ALIGN (_Alignof(max_align_t))
+
+extern _Thread_local Arena compile_arena;
+
+void* arena_grow(Arena* arena, size_t size);
+void reset_arena(Arena* arena);
+void destroy_arena(Arena* arena);
+void destroy_compile_arena(void);
+
+/*
+ * Almost every allocation is just a pointer bump. When the current chunk
+ * is full, a new one is started.
+ */
+static inline void* arena_alloc(Arena* arena, size_t size) {
+
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if(size == 0)
+        size = ARENA_ALIGN;
+
+    if((size_t)(arena->end - arena->next) < size)
+        return arena_grow(arena, size);
+
+    void* ptr = arena->next;
+    arena->next += size;
+    arena->total += size;
+    return ptr;
+}
+
 #endif /* _MEMORY_H_ */
@@ -24,23 +24,24 @@
 #define PATH_MAX FILENAME_MAX
 #endif 
 
-static LinkList* paths;
+static _Thread_local LinkList* paths;
 
 static inline bool is_file(const char* name) {
 
     struct stat sb;
-    stat(name, &sb);
+    if(stat(name, &sb) != 0)
+        return false;
     return ((sb.st_mode & S_IFMT) == S_IFREG);
 }
 
 /**
  * @brief Find a real file to open using stat(). Returns the full path of
- * the file.
+ * the file, or NULL if it cannot be found.
  *
  * @param name
  * @return String*
  */
-String* find_file(const char* name) {
+String* search_file(const char* name) {
 
     ENTER;
 
@@ -78,10 +79,25 @@ String* find_file(const char* name) {
             }
         }
     }
-    fatal_error("Cannot find input file: %s", name);
     RETV(NULL);
 }
 
+/**
+ * @brief Find a real file to open. It is a fatal error if it cannot be
+ * found.
+ *
+ * @param name
+ * @return String*
+ */
+String* find_file(const char* name) {
+
+    ENTER;
+    String* path = search_file(name);
+    if(path == NULL)
+        fatal_error("Cannot find input file: %s", name);
+    RETV(path);
+}
+
 void add_path(const char* name) {
 
     ENTER;
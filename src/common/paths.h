@@ -15,6 +15,7 @@
 
 void init_paths(const char** names);
 void add_path(const char* name);
+String* search_file(const char* name);
 String* find_file(const char* name);
 
 #endif /* __PATHS_H__ */
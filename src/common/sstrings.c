@@ -16,8 +16,9 @@
  */
 static void append_string(String* ptr, const char* buffer, size_t size) {
 
-    if(ptr->len + (int)size > ptr->cap) {
-        while(ptr->len + (int)size > ptr->cap)
+    // leave room for the terminating zero
+    if(ptr->len + (int)size >= ptr->cap) {
+        while(ptr->len + (int)size >= ptr->cap)
             ptr->cap <<= 1;
         ptr->buffer = _REALLOC(ptr->buffer, ptr->cap);
     }
@@ -135,6 +136,24 @@ void add_string_str(String* ptr, const char* str) {
     append_string(ptr, str, strlen(str));
 }
 
+/**
+ * @brief Add a run of characters that is not zero terminated to the string.
+ * This is used to copy large blocks without going character by character.
+ *
+ * @param ptr
+ * @param buf
+ * @param len
+ *
+ */
+void add_string_buf(String* ptr, const char* buf, int len) {
+
+    assert(ptr != NULL);
+    assert(buf != NULL || len == 0);
+
+    if(len > 0)
+        append_string(ptr, buf, (size_t)len);
+}
+
 /**
  * @brief Add an array of chars to the string with formatting.
  *
@@ -30,6 +30,7 @@ void destroy_string(String* ptr);
 void add_string_char(String* ptr, int ch);
 void add_string_str(String* ptr, const char* str);
 void add_string_fmt(String* ptr, const char* str, ...);
+void add_string_buf(String* ptr, const char* buf, int len);
 
 int iterate_string(StrList* ptr, void** mark);
 
@@ -17,9 +17,9 @@
 #include "scanner.h"
 #include "trace.h"
 
-int trace_count             = 0;
-const int trace_increment   = 4;
-LinkList* trace_state_stack = NULL;
+_Thread_local int trace_count             = 0;
+const int trace_increment                 = 4;
+_Thread_local LinkList* trace_state_stack = NULL;
 
 void push_trace_state(bool state) {
 
@@ -71,8 +71,8 @@ void print_terminal(void* ptr) {
     assert(ptr != NULL);
     Token* tok = (Token*)ptr;
 
-    printf("%s: \"%s\": %d: %d: \"%s\"", tok_to_str(tok), raw_string(tok->str),
-           tok->line_no, tok->col_no, tok->fname);
+    printf("%s: \"%s\": %d: %d: \"%s\"", tok_to_str(tok), token_text(tok),
+           tok->line_no, tok->col_no, token_fname(tok));
 }
 
 void print_nonterminal(void* ptr) {
@@ -15,7 +15,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 
-extern int trace_count;
+extern _Thread_local int trace_count;
 extern const int trace_increment;
 void push_trace_state(bool state);
 void set_trace_state(bool state);
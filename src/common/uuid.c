@@ -16,7 +16,7 @@
 #include "memory.h"
 #include "uuid.h"
 
-static bool seeded = false;
+static _Thread_local bool seeded = false;
 
 /**
  * @brief Convert a buffer of bytes to a string.
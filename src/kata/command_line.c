@@ -234,6 +234,11 @@ static void save_cmd(Cmd* cmd, CmdItem* ci, const char* str) {
 // Future enhancement: Support commas to create a list in a single parameter.
 // for example: -x=123,abc,qwe,238 would be a list of 4 items connected to -x
 #endif
+        // a value that is given replaces the default
+        if(!(ci->flag & CMD_LIST)) {
+            destroy_string_list(ci->list);
+            ci->list = create_string_list();
+        }
         add_string_list(ci->list, create_string(str));
     }
     else
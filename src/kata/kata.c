@@ -16,40 +16,87 @@
 //#include "pass.h"
 #include "command_line.h"
 #include "sympass.h"
-
-void pre_test_pass(ast_node* node);
-void post_test_pass(ast_node* node);
+#include "bodypass.h"
+#include "testpass.h"
+#include "passes.h"
+#include "memo.h"
+#include "memory.h"
+#include "parse_stats.h"
+#include "pool.h"
+#include "interface.h"
+#include "lazy.h"
+#include "import_jobs.h"
 
 int main(int argc, char** argv) {
 
+    atexit(destroy_compile_arena);
     INIT_TRACE;
     SET_TRACE_STATE(false);
     ENTER;
 
     CmdLine cmd = create_cmd_line("The Kata programming language");
     add_cmd(cmd, "", "file", "Name of file to compile.", NULL, CMD_REQD | CMD_STR);
+    add_cmd(cmd, "-m", "nomemo", "Do not save the results of parser rules.", NULL, CMD_BOOL);
+    add_cmd(cmd, "-a", "pool", "Pack the AST into a node pool and expand it back before the passes run.", NULL, CMD_BOOL);
+    add_cmd(cmd, "-i", "interface", "Load imported modules from interface files, and write them.", NULL, CMD_BOOL);
+    add_cmd(cmd, "-l", "lazy", "Skip the function bodies of imported modules until a pass needs them.", NULL, CMD_BOOL);
+    add_cmd(cmd, "-j", "jobs", "Number of threads that parse imported modules.", "1", CMD_INT);
+    add_cmd(cmd, "--parse-stats", "parse-stats", "Report what every parser rule did and the time it took.", NULL, CMD_BOOL);
+    add_cmd(cmd, "--import-stats", "import-stats", "Report how the imported modules were loaded.", NULL, CMD_BOOL);
+    add_cmd(cmd, "--test-pass", "test-pass", "Run the test pass, which traces every node of the AST.", NULL, CMD_BOOL);
+    add_cmd(cmd, "--pass-stats", "pass-stats", "Report the time that every AST pass took.", NULL, CMD_BOOL);
     parse_cmd_line(cmd, argc, argv);
 
     // dump_cmd_line(cmd);
 
+    set_memo_state(!get_cmd_bool(cmd, "nomemo"));
+    set_parse_stats(get_cmd_bool(cmd, "parse-stats"));
+    set_pass_stats(get_cmd_bool(cmd, "pass-stats"));
+    set_interface_state(get_cmd_bool(cmd, "interface"));
+    set_lazy_state(get_cmd_bool(cmd, "lazy"));
     init_parser(get_cmd_raw(cmd, "file"));
+    start_import_jobs((int)get_cmd_int(cmd, "jobs"));
 
     SET_TRACE_STATE(false);
     TRACE("--------------------------------------------");
     TRACE("Begin Parse");
     ast_module* node = parse();
+    stop_import_jobs();
     TRACE("End Parse");
     TRACE("--------------------------------------------");
 
+    if(get_cmd_bool(cmd, "parse-stats"))
+        report_parse_stats();
+
+    // The passes still take pointer trees, so this only checks the round trip
+    // through the pool. The tree that the parser made stays in the compile
+    // arena next to the expanded one, so it costs memory.
+    if(get_cmd_bool(cmd, "pool") && node != NULL) {
+        AstPool* pool = pack_ast(node);
+        node          = expand_ast_pool(pool);
+        destroy_ast_pool(pool);
+    }
+
     SET_TRACE_STATE(true);
     TRACE("--------------------------------------------");
     TRACE("Begin Symbol Traverse");
-    traverse_ast(node, pre_sym_pass, post_sym_pass);
+    register_pass_table("symbols", &sym_pass);
+    if(get_cmd_bool(cmd, "test-pass")) {
+        register_pass_table("test", &test_pass);
+        require_function_bodies("test");
+    }
+    run_passes(node);
     TRACE("End Symbol Traverse");
     TRACE("--------------------------------------------");
 
     SET_TRACE_STATE(false);
 
+    if(get_cmd_bool(cmd, "pass-stats"))
+        report_pass_stats();
+
+    if(get_cmd_bool(cmd, "import-stats"))
+        report_import_stats();
+
     dump_symtab();
 
     RETV(0);
@@ -10,7 +10,9 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
+#include "memo.h"
 
 /**
  * @brief
@@ -23,15 +25,16 @@
  */
 ast_compound_name* parse_compound_name(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_compound_name* node = NULL;
-    LinkList* lst = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
     String* str = create_string(NULL);
     Token* tok;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         tok = get_token();
@@ -40,8 +43,8 @@ ast_compound_name* parse_compound_name(void) {
                 // initial state
                 TRACE("state = %d", state);
                 if(TOK_SYMBOL == token_type(tok)) {
-                    append_link_list(lst, tok);
-                    add_string_Str(str, tok->str);
+                    add_ast_buf(&buf, tok);
+                    add_string_Str(str, token_str(tok));
                     TRACE_TERM(tok);
                     advance_token();
                     state = 1;
@@ -72,8 +75,8 @@ ast_compound_name* parse_compound_name(void) {
                     state = 101;
                 else if(TOK_SYMBOL == token_type(tok)) {
                     TRACE_TERM(tok);
-                    append_link_list(lst, tok);
-                    add_string_Str(str, tok->str);
+                    add_ast_buf(&buf, tok);
+                    add_string_Str(str, token_str(tok));
                     advance_token();
                     state = 1;
                 }
@@ -87,7 +90,7 @@ ast_compound_name* parse_compound_name(void) {
                 // is a compound name, and not an error
                 TRACE("state = %d", state);
                 node = CREATE_AST_NODE(AST_compound_name, ast_compound_name);
-                node->list = lst;
+                node->list = finish_ast_buf(&buf);
                 node->raw_name = str;
                 finished = true;
                 break;
@@ -112,7 +115,7 @@ ast_compound_name* parse_compound_name(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -126,10 +129,11 @@ ast_compound_name* parse_compound_name(void) {
  */
 ast_compound_name_list* parse_compound_name_list(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_compound_name_list* node = NULL;
     ast_compound_name* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
 
     int state = 0;
     bool finished = false;
@@ -153,7 +157,7 @@ ast_compound_name_list* parse_compound_name_list(void) {
                 TRACE("state = %d", state);
                 TRACE_TERM(get_token());
                 if(NULL != (nterm = parse_compound_name())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 2;
                 }
                 else if(TOK_CPAREN == TTYPE) {
@@ -189,7 +193,7 @@ ast_compound_name_list* parse_compound_name_list(void) {
                 TRACE("state = %d", state);
                 TRACE_TERM(get_token());
                 if(NULL != (nterm = parse_compound_name())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 2;
                 }
                 else {
@@ -202,7 +206,7 @@ ast_compound_name_list* parse_compound_name_list(void) {
                 // complete non-terminal parsed
                 TRACE("state = %d", state);
                 node = CREATE_AST_NODE(AST_compound_name_list, ast_compound_name_list);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -225,7 +229,7 @@ ast_compound_name_list* parse_compound_name_list(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -239,14 +243,14 @@ ast_compound_name_list* parse_compound_name_list(void) {
  */
 ast_compound_ref_item* parse_compound_ref_item(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_compound_ref_item* node = NULL;
     ast_array_param_list* apar = NULL;
     Token* symb = NULL;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -324,7 +328,7 @@ ast_compound_ref_item* parse_compound_ref_item(void) {
     //     reset_token_queue(post);
     // }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -336,17 +340,18 @@ ast_compound_ref_item* parse_compound_ref_item(void) {
  * @return ast_compound_reference*
  *
  */
-ast_compound_reference* parse_compound_reference(void) {
+static ast_compound_reference* compound_reference_rule(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_compound_reference* node = NULL;
     ast_compound_ref_item* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
     Token* tok;
 
     int state = 0;
     bool finished = false;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         tok = get_token();
@@ -355,7 +360,7 @@ ast_compound_reference* parse_compound_reference(void) {
                 // entry point
                 TRACE("state = %d", state);
                 if(NULL != (nterm = parse_compound_ref_item())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 1;
                 }
                 else {
@@ -379,7 +384,7 @@ ast_compound_reference* parse_compound_reference(void) {
                 // must be a compound_ref_item
                 TRACE("state = %d", state);
                 if(NULL != (nterm = parse_compound_ref_item())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 1;
                 }
                 else {
@@ -392,7 +397,7 @@ ast_compound_reference* parse_compound_reference(void) {
                 // finished, not an error, return the node
                 TRACE("state = %d", state);
                 node = CREATE_AST_NODE(AST_compound_reference, ast_compound_reference);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 //finalize_token_queue();
                 finished = true;
                 break;
@@ -418,7 +423,28 @@ ast_compound_reference* parse_compound_reference(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
+}
+
+/**
+ * @brief Parse a compound reference, or use the result that was saved the
+ * last time that it was tried at this token.
+ *
+ * @return ast_compound_reference*
+ *
+ */
+ast_compound_reference* parse_compound_reference(void) {
+
+    RULE_ENTER;
+    ast_compound_reference* node;
+    TokPost post = post_token_queue();
+
+    if(!find_memo(MEMO_COMPOUND_REFERENCE, post, (void**)&node)) {
+        node = compound_reference_rule();
+        save_memo(MEMO_COMPOUND_REFERENCE, post, node);
+    }
+
+    RULE_RETV(node);
 }
 
 
@@ -10,6 +10,7 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -23,16 +24,17 @@
  */
 ast_try_clause* parse_try_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_try_clause* node = NULL;
     ast_function_body* fbod;
     ast_final_clause* final = NULL;
-    LinkList* except_list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
     ast_except_clause* ecla;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -64,7 +66,7 @@ ast_try_clause* parse_try_clause(void) {
                 if(NULL != (final = parse_final_clause())) 
                     state = 100;
                 else if(NULL != (ecla = parse_except_clause()))
-                    append_link_list(except_list, ecla); // keep the same state
+                    add_ast_buf(&buf, ecla); // keep the same state
                 else {
                     // anything else finishes the production
                     state = 100;
@@ -76,7 +78,7 @@ ast_try_clause* parse_try_clause(void) {
                 TRACE("state = %d", state);
                 node = CREATE_AST_NODE(AST_try_clause, ast_try_clause);
                 node->fbod = fbod;
-                node->except_list = except_list;
+                node->except_list = finish_ast_buf(&buf);
                 node->final = final;
                 finished = true;
                 break;
@@ -100,7 +102,7 @@ ast_try_clause* parse_try_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -114,7 +116,7 @@ ast_try_clause* parse_try_clause(void) {
  */
 ast_except_clause* parse_except_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_except_clause* node = NULL;
     Token* name;
     Token* msg;
@@ -122,7 +124,7 @@ ast_except_clause* parse_except_clause(void) {
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
 
     while(!finished) {
@@ -247,7 +249,7 @@ ast_except_clause* parse_except_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -261,14 +263,14 @@ ast_except_clause* parse_except_clause(void) {
  */
 ast_final_clause* parse_final_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_final_clause* node = NULL;
     Token* msg;
     ast_function_body* fbod;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
 
     while(!finished) {
@@ -364,6 +366,6 @@ ast_final_clause* parse_final_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
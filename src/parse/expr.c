@@ -8,14 +8,21 @@
  * @date 02-26-2024
  * @copyright Copyright (c) 2024
  */
+#include "first_sets.h"
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
-// This is used to detect unary operators. If it is true, and an operator is
-// found then it could be unary. Only the '!' and the '-' can be unary, all
-// others are errors if the flag is set.
-static bool flag = true;
+/*
+ * The state of one expression while it is being parsed. It lives on the stack
+ * of parse_expression(), so an expression that is nested in another one, such
+ * as in the parameters of a formatted string, has its own.
+ */
+typedef struct {
+    int expr_type; // what set_expr_type() has found so far
+    bool error;    // an error has been reported
+} ExprState;
 
 // Boolean expressions take precedence over arithmetic. Any boolean
 // operator in the expression causes the whole expression to be a boolean,
@@ -110,111 +117,148 @@ static bool get_assoc(TokenType type) {
     }
 }
 
-/**
- * @brief
- *
- *  ast_operator
- *      = AND
- *      / OR
- *      / '=='
- *      / '!='
- *      / '<'
- *      / '>'
- *      / '<='
- *      / '>='
- *      / '+'
- *      / '-'
- *      / '*'
- *      / '/'
- *      / '%'
- *      / '^'
- *      / UNARY_MINUS
- *      / '!'
- *      / '('
- *      / ')'
- *
- * @return ast_operator*
- *
- */
-ast_operator* parse_operator(void) {
+// Operators that take an operand on each side.
+static bool is_binary(TokenType type) {
 
-    ENTER;
-    ast_operator* node = NULL;
-    Token* tok = get_token();
-
-    switch(token_type(tok)) {
-        case TOK_AND:
+    switch(type) {
         case TOK_OR:
+        case TOK_AND:
+        case TOK_EQU:
+        case TOK_NEQU:
         case TOK_LORE:
         case TOK_GORE:
         case TOK_OPBRACE:
         case TOK_CPBRACE:
-        case TOK_EQU:
-        case TOK_NEQU:
         case TOK_ADD:
+        case TOK_SUB:
         case TOK_DIV:
         case TOK_MUL:
         case TOK_MOD:
         case TOK_CARAT:
-            // these operators must not be unary
-            if(!flag) {
-                TRACE_TERM(tok);
-                node = CREATE_AST_NODE(AST_operator, ast_operator);
-                node->tok = tok;
-                //advance_token();
-                flag = true;
-            }
-            else
-                show_syntax("the %s operator must not be unary", tok_to_str(tok));
-            break;
+            return true;
+        default:
+            return false;
+    }
+}
 
-        case TOK_SUB:
-            // the '-' can be unary
-            TRACE_TERM(get_token());
-            node = CREATE_AST_NODE(AST_operator, ast_operator);
-            node->tok = tok;
-            if(flag)
-                node->tok->type = TOK_UNARY_MINUS;
-            //advance_token();
-            flag = true;
-            break;
+// An operand is required but the current token is not one.
+static void expected_operand(ExprState* state) {
+
+    if(!state->error) {
+        if(is_binary(TTYPE))
+            SYNTAX("the '%s' operator cannot be unary", tok_to_str(get_token()));
+        else
+            EXPECTED("a primary expression");
+        state->error = true;
+    }
+}
+
+static ast_node* parse_infix(ExprState* state, int min_prec);
+
+/**
+ * @brief Parse an operand, which is a primary, a parenthesized expression,
+ * or a prefix operator and its operand. Returns NULL with no error if the
+ * token cannot start an operand.
+ *
+ *  expr_unary
+ *      = '!' expr_unary
+ *      / '-' expr_unary
+ *      / '(' expression ')'
+ *      / expr_primary
+ *
+ * @param state
+ * @return ast_node*
+ *
+ */
+static ast_node* parse_operand(ExprState* state) {
+
+    RULE_ENTER;
+    ast_node* node = NULL;
+    ast_node* nterm;
+    Token* oper;
 
+    switch(TTYPE) {
         case TOK_NOT:
-            // the '!' or 'not' must be unary
-            TRACE_TERM(get_token());
-            if(flag) {
-                node = CREATE_AST_NODE(AST_operator, ast_operator);
-                node->tok = tok;
-                //advance_token();
-                flag = true;
+        case TOK_SUB:
+            oper = get_token();
+            if(TOK_SUB == token_type(oper))
+                oper->type = TOK_UNARY_MINUS;
+            advance_token();
+            state->expr_type = set_expr_type(token_type(oper), state->expr_type);
+
+            // the operand only takes operators that bind tighter than this
+            if(NULL != (nterm = parse_infix(state, get_prec(token_type(oper))))) {
+                ast_expr_unary* unary = CREATE_AST_NODE(AST_expr_unary, ast_expr_unary);
+                unary->oper    = oper;
+                unary->operand = nterm;
+                node           = (ast_node*)unary;
             }
             else
-                show_syntax("the not operator must be unary");
+                expected_operand(state);
             break;
 
         case TOK_OPAREN:
-            TRACE_TERM(get_token());
-            node = CREATE_AST_NODE(AST_operator, ast_operator);
-            node->tok = tok;
-            //advance_token();
-            flag = true;
-            break;
-
-        case TOK_CPAREN:
-            TRACE_TERM(get_token());
-            node = CREATE_AST_NODE(AST_operator, ast_operator);
-            node->tok = tok;
-            //advance_token();
-            flag = false;
+            advance_token();
+            if(NULL != (node = parse_infix(state, 0))) {
+                if(TOK_CPAREN == TTYPE)
+                    advance_token();
+                else {
+                    EXPECTED("a ')'");
+                    state->error = true;
+                    node = NULL;
+                }
+            }
+            else
+                expected_operand(state);
             break;
 
         default:
+            node = (ast_node*)parse_expr_primary();
             break;
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
+/**
+ * @brief Parse an operand followed by any binary operators that bind at
+ * least as tightly as the minimum. This is where the precedence and the
+ * associativity tables are used.
+ *
+ * @param state
+ * @param min_prec
+ * @return ast_node*
+ *
+ */
+static ast_node* parse_infix(ExprState* state, int min_prec) {
+
+    RULE_ENTER;
+    ast_node* lhs = parse_operand(state);
+    ast_node* rhs;
+
+    while(lhs != NULL && is_binary(TTYPE) && get_prec(TTYPE) >= min_prec) {
+        Token* oper = get_token();
+        TokenType type = token_type(oper);
+        int prec = get_prec(type);
+        advance_token();
+        state->expr_type = set_expr_type(type, state->expr_type);
+
+        // a left associative operator stops the right side at its own level
+        if(NULL == (rhs = parse_infix(state, get_assoc(type) ? prec + 1 : prec))) {
+            expected_operand(state);
+            lhs = NULL;
+            break;
+        }
+
+        ast_expr_binary* binary = CREATE_AST_NODE(AST_expr_binary, ast_expr_binary);
+        binary->oper = oper;
+        binary->lhs  = lhs;
+        binary->rhs  = rhs;
+        lhs          = (ast_node*)binary;
+    }
+
+    RULE_RETV(lhs);
+}
 
 /**
  * @brief
@@ -227,9 +271,9 @@ ast_operator* parse_operator(void) {
  */
 ast_cast_statement* parse_cast_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_cast_statement* node = NULL;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
     ast_type_name* type;
     ast_expression* expr;
 
@@ -251,7 +295,7 @@ ast_cast_statement* parse_cast_statement(void) {
     else // not a cast, not an error
         reset_token_queue(post);
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
@@ -267,28 +311,26 @@ ast_cast_statement* parse_cast_statement(void) {
  */
 ast_expr_primary* parse_expr_primary(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_expr_primary* node = NULL;
     ast_node* nterm;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if(NULL != (nterm = (ast_node*)parse_literal_value())) {
         TRACE("literal value");
         TRACE_TERM(get_token());
         node = CREATE_AST_NODE(AST_expr_primary, ast_expr_primary);
         node->nterm = nterm;
-        flag = false;
     }
     else if (NULL != (nterm = (ast_node*)parse_compound_reference())) {
         TRACE("compound reference");
         node = CREATE_AST_NODE(AST_expr_primary, ast_expr_primary);
         node->nterm = nterm;
-        flag = false;
     }
     else
         reset_token_queue(post);
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
@@ -303,19 +345,20 @@ ast_expr_primary* parse_expr_primary(void) {
  */
 ast_expression_list* parse_expression_list(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_expression_list* node = NULL;
     ast_expression* expr;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
     bool finished = false;
     int state = 0;
     int pcount = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
             case 0:
-                TRACE("state: %d, len: %d", state, len_link_list(list));
+                TRACE("state: %d, len: %d", state, buf.len);
                 // open paren required, or no error, no tokens consumed
                 if(TOK_OPAREN == TTYPE) {
                     pcount++;
@@ -326,10 +369,10 @@ ast_expression_list* parse_expression_list(void) {
                     state = 101;
                 break;
             case 1:
-                TRACE("state: %d, len: %d", state, len_link_list(list));
+                TRACE("state: %d, len: %d", state, buf.len);
                 // expression is optional for first time through
                 if(NULL != (expr = parse_expression())) {
-                    append_link_list(list, expr);
+                    add_ast_buf(&buf, expr);
                     state = 2;
                 }
                 else if(TOK_CPAREN == TTYPE) {
@@ -343,7 +386,7 @@ ast_expression_list* parse_expression_list(void) {
                 }
                 break;
             case 2:
-                TRACE("state: %d, len: %d", state, len_link_list(list));
+                TRACE("state: %d, len: %d", state, buf.len);
                 TRACE_TERM(get_token());
                 // require an ',' or a ')'
                 if(TOK_COMMA == TTYPE) {
@@ -361,10 +404,10 @@ ast_expression_list* parse_expression_list(void) {
                 }
                 break;
             case 3:
-                TRACE("state: %d, len: %d", state, len_link_list(list));
+                TRACE("state: %d, len: %d", state, buf.len);
                 // expression is required after a ','
                 if(NULL != (expr = parse_expression())) {
-                    append_link_list(list, expr);
+                    add_ast_buf(&buf, expr);
                     state = 2;
                 }
                 else {
@@ -374,23 +417,22 @@ ast_expression_list* parse_expression_list(void) {
                 break;
 
             case 100:
-                TRACE("state: %d, len: %d, pcount: %d", state, len_link_list(list), pcount);
+                TRACE("state: %d, len: %d, pcount: %d", state, buf.len, pcount);
                 // finished no error
                 node = CREATE_AST_NODE(AST_expression_list, ast_expression_list);
-                node->list = list;
-                finalize_token_queue();
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
             case 101:
-                TRACE("state: %d, len: %d", state, len_link_list(list));
+                TRACE("state: %d, len: %d", state, buf.len);
                 // finished no expression with no error
                 reset_token_queue(post);
                 finished = true;
                 break;
 
             case 102:
-                TRACE("state: %d, len: %d", state, len_link_list(list));
+                TRACE("state: %d, len: %d", state, buf.len);
                 // finished with an error
                 node = NULL;
                 finished = true;
@@ -401,7 +443,7 @@ ast_expression_list* parse_expression_list(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -418,10 +460,14 @@ ast_expression_list* parse_expression_list(void) {
  */
 ast_assignment_item* parse_assignment_item(void) {
 
-    ENTER;
+    RULE_ENTER;
+    // nothing here can start with this token
+    if(!CAN_START(assignment_item))
+        RULE_RETV(NULL);
+
     ast_assignment_item* node = NULL;
     ast_node* nterm;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if( (NULL != (nterm = (ast_node*)parse_function_assignment())) ||
         (NULL != (nterm = (ast_node*)parse_list_init())) ||
@@ -435,7 +481,7 @@ ast_assignment_item* parse_assignment_item(void) {
     else
         reset_token_queue(post);
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 // TODO: make production match the grammar.
@@ -455,7 +501,7 @@ ast_assignment_item* parse_assignment_item(void) {
  */
 ast_assignment* parse_assignment(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_assignment* node = NULL;
     ast_compound_reference* lhs;
     ast_node* rhs;
@@ -463,7 +509,7 @@ ast_assignment* parse_assignment(void) {
 
     bool finished = false;
     int state  = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -553,266 +599,41 @@ ast_assignment* parse_assignment(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
 /**
- * @brief This implements a shunting yard algorithm, but it's broken. The actual expression
- * parser is moved to another module.
+ * @brief This is a precedence climbing (Pratt) parser. It builds a tree of
+ * binary and unary nodes using get_prec() and get_assoc(), so there is no
+ * operator stack and nothing to undo but the token queue.
  *
  *  expression
- *      = expr_and 'or' expr_or
- *      / expr_equ 'and' expr_and
- *      / expr_mag '==' expr_equ
- *      / expr_mag '!=' expr_equ
- *      / expr_term '<' expr_mag
- *      / expr_term '>' expr_mag
- *      / expr_term '<=' expr_mag
- *      / expr_term '>=' expr_mag
- *      / expr_fact '+' expr_term
- *      / expr_fact '-' expr_term
- *      / expr_pow '*' expr_fact
- *      / expr_pow '/' expr_fact
- *      / expr_pow '%' expr_fact
- *      / expr_unary '^' expr_pow
- *      / '!' expr_primary
- *      / '-' expr_primary
- *      / '(' expression ')'
+ *      = expr_and ( 'or' expr_and )*
  *
  * @return ast_expression*
  *
  */
 ast_expression* parse_expression(void) {
 
-    ENTER;
-    ast_expression* node = NULL;
-    LinkList* stack = create_link_list();
-    LinkList* queue = create_link_list();
-    ast_node* nterm;
-    void* post = post_token_queue();
-    int expr_type = 0;
+    RULE_ENTER;
+    // nothing here can start with this token
+    if(!CAN_START(expression))
+        RULE_RETV(NULL);
 
-    int state = 0;
-    int pcount = 0;
-    bool finished = false;
-
-    flag = true;
-    while(!finished) {
-        switch(state) {
-            case 0:
-                // entry point; make sure it's an expression
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                TRACE_TERM(get_token());
-                if(NULL != (nterm = (ast_node*)parse_operator())) {
-                    switch(token_type(((ast_operator*)nterm)->tok)) {
-                        case TOK_CPAREN:
-                            state = 101; // empty expression
-                            break;
-                        case TOK_NOT:
-                        case TOK_UNARY_MINUS:
-                        case TOK_OPAREN:
-                            state = 4; // begins with a unary oper or a oparen
-                            break;
-                        default:
-                            SYNTAX("the '%s' operator cannot be unary", tok_to_str(((ast_operator*)nterm)->tok));
-                            state = 102;
-                    }
-                }
-                else if (NULL != (nterm = (ast_node*)parse_expr_primary()))
-                    state = 54; // begins with an actual value
-                else
-                    state = 101; // Else it's not recognized as an expression. No error.
-                break;
-
-            case 1:
-                // must have an operator or a primary, else end of parse
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                if(NULL != (nterm = (ast_node*)parse_operator()))
-                    state = 4; // dispatch the operator
-                else if (NULL != (nterm = (ast_node*)parse_expr_primary()))
-                    state = 54;
-                else
-                    state = 100;
-                break;
-
-            case 2:
-                // must be a primary after an operator, or an error
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                if (NULL != (nterm = (ast_node*)parse_expr_primary()))
-                    state = 54;
-                else {
-                    EXPECTED("a primary expression");
-                    state = 102;
-                }
-                break;
-
-            case 3:
-                // Must have an operator after a primary, else end of parse
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                if(NULL != (nterm = (ast_node*)parse_operator()))
-                    state = 4; // dispatch the operator
-                else 
-                    state = 100;
-                break;
-
-            case 4: {
-                    // dispatch an operator
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                    TokenType type = token_type(((ast_operator*)nterm)->tok);
-                    switch(type) {
-                        case TOK_OPAREN:
-                            advance_token();
-                            state = 50;
-                            pcount++;
-                            break;
-                        case TOK_CPAREN:
-                            pcount--;
-                            if(pcount >= 0) {
-                                advance_token();
-                                state = 51;
-                            }
-                            // not an error because of ( 2*(4+3)). The 
-                            // first oparen is not part of the expression,
-                            // but the thing that uses it.
-                            else if(pcount < 0)
-                                state = 100;
-                            break;
-                        default:
-                            advance_token();
-                            if(get_assoc(type))
-                                state = 52;
-                            else
-                                state = 53;
-                            break;
-                    }
-
-                    expr_type = set_expr_type(type, expr_type);
-                }
-                break;
-
-            case 5:
-                // must have an operator or a primary, else an error
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                if(NULL != (nterm = (ast_node*)parse_operator()))
-                    state = 4; // dispatch the operator
-                else if (NULL != (nterm = (ast_node*)parse_expr_primary()))
-                    state = 54;
-                else {
-                    EXPECTED("an operator or a primary expression");
-                    state = 102;
-                }
-                break;
-
-            // Actual shunting yard algo starts here
-            case 50:
-                // operator is an open paren
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                push_link_list(stack, nterm);
-                state = 5; // must be a primary, or an operaotr, or an error
-                break;
-
-            case 51:
-                // operator is close paren
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                state = 3; // must have an operator
-                while(true) {
-                    ast_operator* op = (ast_operator*)pop_link_list(stack);
-                    if(NULL == op) {
-                        SYNTAX("imbalanced parens in expression");
-                        state = 102;
-                        break;
-                    }
-                    else if(TOK_OPAREN == token_type(op->tok)) {
-                        state = 1; // must have an operator, or a primary, or end of parse
-                        break;
-                    }
-                    else
-                        append_link_list(queue, op);
-                }
-                break;
-
-            case 52:
-                // operator is left assoc
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                TRACE("left assoc");
-                while(peek_link_list(stack) != NULL &&
-                        (get_prec(token_type(((ast_operator*)peek_link_list(stack))->tok))) >=
-                        (get_prec(token_type(((ast_operator*)nterm)->tok)))) {
-
-                    append_link_list(queue, pop_link_list(stack));
-                }
-                push_link_list(stack, nterm);
-                state = 5; // must have a primary or an error
-                break;
-
-            case 53:
-                // operator is right assoc
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                TRACE("right assoc");
-                while(peek_link_list(stack) != NULL &&
-                        (get_prec(token_type(((ast_operator*)peek_link_list(stack))->tok))) >
-                        (get_prec(token_type(((ast_operator*)nterm)->tok)))) {
-
-                    append_link_list(queue, pop_link_list(stack));
-                }
-                push_link_list(stack, nterm);
-                state = 5; // must have a primary or an error
-                break;
-
-            case 54:
-                // handle a primary
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                append_link_list(queue, nterm);
-                state = 3; // must be operator or end of parse
-                break;
-
-            // exit routines. All of these cause the super-loop to exit.
-            case 100:
-                // Finished parsing the production
-                TRACE("state: %d, stack: %d, queue: %d, pcount: %d",
-                        state, len_link_list(stack), len_link_list(queue), pcount);
-                TRACE_TERM(get_token());
-                if(pcount > 0) {
-                    //SYNTAX("imbalanced parentheses in expression");
-                    EXPECTED("a ')'");
-                    state = 102;
-                }
-                else {
-                    // finished expression
-                    while(peek_link_list(stack) != NULL)
-                        append_link_list(queue, pop_link_list(stack));
-
-                    node = CREATE_AST_NODE(AST_expression, ast_expression);
-                    node->list = queue;
-                    node->expr_type = expr_type;
-                    //finalize_token_queue();
-                    finished = true;
-                }
-                break;
-
-            case 101:
-                // not an expression, not an error;
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                reset_token_queue(post);
-                finished = true;
-                break;
-
-            case 102:
-                // exit on a syntax error;
-                TRACE("state: %d", state);
-                node = NULL;
-                finished = true;
-                break;
-
-            default:
-                TRACE("state: %d, stack: %d, queue: %d", state, len_link_list(stack), len_link_list(queue));
-                // cannot happen
-                fatal_error("invalid state in %s: %d", __func__, state);
-                break;
-        }
+    ast_expression* node = NULL;
+    ExprState state      = {0, false};
+    TokPost post         = post_token_queue();
+    ast_node* expr;
+
+    if(NULL != (expr = parse_infix(&state, 0))) {
+        node            = CREATE_AST_NODE(AST_expression, ast_expression);
+        node->expr      = expr;
+        node->expr_type = state.expr_type;
     }
+    else if(!state.error)
+        // not an expression, not an error
+        reset_token_queue(post);
 
-    RETV(node);
+    RULE_RETV(node);
 }
-
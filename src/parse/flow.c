@@ -10,6 +10,7 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -23,18 +24,19 @@
  */
 ast_if_clause* parse_if_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_if_clause* node = NULL;
     ast_expression* expr;
     ast_function_body* fbod;
     ast_else_clause* eclaus = NULL;
     ast_elif_clause* elif = NULL;
-    LinkList* elif_list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
 
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -103,7 +105,7 @@ ast_if_clause* parse_if_clause(void) {
                 if(NULL != (eclaus = parse_else_clause())) 
                     state = 100;
                 else if(NULL != (elif = parse_elif_clause())) {
-                    append_link_list(elif_list, elif);
+                    add_ast_buf(&buf, elif);
                     // keep this state
                 }
                 else 
@@ -117,7 +119,7 @@ ast_if_clause* parse_if_clause(void) {
                 node->expr = expr;
                 node->fbod = fbod;
                 node->eclaus = eclaus;
-                node->elif_list = elif_list;
+                node->elif_list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -141,7 +143,7 @@ ast_if_clause* parse_if_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -155,14 +157,14 @@ ast_if_clause* parse_if_clause(void) {
  */
 ast_elif_clause* parse_elif_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_elif_clause* node = NULL;
     ast_expression* expr;
     ast_function_body* fbod;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -254,7 +256,7 @@ ast_elif_clause* parse_elif_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -268,13 +270,13 @@ ast_elif_clause* parse_elif_clause(void) {
  */
 ast_else_clause* parse_else_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_else_clause* node = NULL;
     ast_function_body* fbod;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -327,6 +329,6 @@ ast_else_clause* parse_else_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
@@ -9,7 +9,9 @@
  * @copyright Copyright (c) 2024
  */
 #include "trace.h"
+#include "lazy.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -23,12 +25,12 @@
  */
 ast_function_reference* parse_function_reference(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_function_reference* node = NULL;
     ast_compound_reference* name;
     ast_expression_list* inp;
     ast_compound_name_list* outp;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -97,7 +99,7 @@ ast_function_reference* parse_function_reference(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -111,11 +113,11 @@ ast_function_reference* parse_function_reference(void) {
  */
 ast_create_reference* parse_create_reference(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_create_reference* node = NULL;
     ast_create_name* name;
     ast_expression_list* inp;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -172,7 +174,7 @@ ast_create_reference* parse_create_reference(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
@@ -187,10 +189,10 @@ ast_create_reference* parse_create_reference(void) {
  */
 ast_destroy_reference* parse_destroy_reference(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_destroy_reference* node = NULL;
     ast_destroy_name* name;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -228,7 +230,7 @@ ast_destroy_reference* parse_destroy_reference(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -243,13 +245,13 @@ ast_destroy_reference* parse_destroy_reference(void) {
  */
 ast_function_declaration* parse_function_declaration(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_function_declaration* node = NULL;
     Token* name;
     bool is_virtual = false;
     ast_type_name_list* inputs;
     ast_type_name_list* outputs;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -356,7 +358,7 @@ ast_function_declaration* parse_function_declaration(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -370,11 +372,11 @@ ast_function_declaration* parse_function_declaration(void) {
  */
 ast_create_declaration* parse_create_declaration(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_create_declaration* node = NULL;
     bool is_virtual = false;
     ast_type_name_list* inputs;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -461,7 +463,7 @@ ast_create_declaration* parse_create_declaration(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -475,10 +477,10 @@ ast_create_declaration* parse_create_declaration(void) {
  */
 ast_destroy_declaration* parse_destroy_declaration(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_destroy_declaration* node = NULL;
     bool is_virtual = false;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -552,7 +554,7 @@ ast_destroy_declaration* parse_destroy_declaration(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -567,14 +569,14 @@ ast_destroy_declaration* parse_destroy_declaration(void) {
  */
 ast_function_definition* parse_function_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_function_definition* node = NULL;
     bool is_virtual = false;
     ast_compound_name* name;
     ast_var_decl_list* inputs;
     ast_var_decl_list* outputs;
     ast_function_body* body;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -631,7 +633,7 @@ ast_function_definition* parse_function_definition(void) {
             case 4:
                 // function body or error
                 TRACE("state = %d", state);
-                if(NULL != (body = parse_function_body()))
+                if(NULL != (body = parse_lazy_function_body()))
                     state = 100;
                 else {
                     EXPECTED("function body");
@@ -681,7 +683,7 @@ ast_function_definition* parse_function_definition(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -695,10 +697,11 @@ ast_function_definition* parse_function_definition(void) {
  */
 ast_create_name* parse_create_name(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_create_name* node = NULL;
-    LinkList* list = create_link_list();
-    void* post = post_token_queue();
+    AstBuf buf;
+    init_ast_buf(&buf);
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -709,7 +712,7 @@ ast_create_name* parse_create_name(void) {
                 // SYMBOL or not a match
                 TRACE("state = %d", state);
                 if(TOK_SYMBOL == TTYPE) {
-                    append_link_list(list, get_token());
+                    add_ast_buf(&buf, get_token());
                     advance_token();
                     state = 1;
                 }
@@ -733,12 +736,12 @@ ast_create_name* parse_create_name(void) {
                 TRACE("state = %d", state);
                 TRACE_TERM(get_token());
                 if(TOK_SYMBOL == TTYPE) {
-                    append_link_list(list, get_token());
+                    add_ast_buf(&buf, get_token());
                     advance_token();
                     state = 1;
                 }
                 else if(TOK_CREATE == TTYPE) {
-                    append_link_list(list, get_token());
+                    add_ast_buf(&buf, get_token());
                     advance_token();
                     state = 100;
                 }
@@ -754,7 +757,7 @@ ast_create_name* parse_create_name(void) {
                 TRACE("state = %d", state);
                 finished = true;
                 node = CREATE_AST_NODE(AST_create_name, ast_create_name);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 //finalize_token_queue();
                 break;
 
@@ -778,7 +781,7 @@ ast_create_name* parse_create_name(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -792,10 +795,11 @@ ast_create_name* parse_create_name(void) {
  */
 ast_destroy_name* parse_destroy_name(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_destroy_name* node = NULL;
-    LinkList* list = create_link_list();
-    void* post = post_token_queue();
+    AstBuf buf;
+    init_ast_buf(&buf);
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -806,7 +810,7 @@ ast_destroy_name* parse_destroy_name(void) {
                 // SYMBOL or not a match
                 TRACE("state = %d", state);
                 if(TOK_SYMBOL == TTYPE) {
-                    append_link_list(list, get_token());
+                    add_ast_buf(&buf, get_token());
                     advance_token();
                     state = 1;
                 }
@@ -830,12 +834,12 @@ ast_destroy_name* parse_destroy_name(void) {
                 TRACE("state = %d", state);
                 TRACE_TERM(get_token());
                 if(TOK_SYMBOL == TTYPE) {
-                    append_link_list(list, get_token());
+                    add_ast_buf(&buf, get_token());
                     advance_token();
                     state = 1;
                 }
                 else if(TOK_DESTROY == TTYPE) {
-                    append_link_list(list, get_token());
+                    add_ast_buf(&buf, get_token());
                     advance_token();
                     state = 100;
                 }
@@ -851,7 +855,7 @@ ast_destroy_name* parse_destroy_name(void) {
                 TRACE("state = %d", state);
                 finished = true;
                 node = CREATE_AST_NODE(AST_destroy_name, ast_destroy_name);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 //finalize_token_queue();
                 break;
 
@@ -875,7 +879,7 @@ ast_destroy_name* parse_destroy_name(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -890,13 +894,13 @@ ast_destroy_name* parse_destroy_name(void) {
  */
 ast_create_definition* parse_create_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_create_definition* node = NULL;
     ast_create_name* name;
     bool is_virtual = false;
     ast_var_decl_list* inputs;
     ast_function_body* body;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -942,7 +946,7 @@ ast_create_definition* parse_create_definition(void) {
             case 4:
                 // function body or error
                 TRACE("state = %d", state);
-                if(NULL != (body = parse_function_body()))
+                if(NULL != (body = parse_lazy_function_body()))
                     state = 100;
                 else {
                     EXPECTED("function body");
@@ -991,7 +995,7 @@ ast_create_definition* parse_create_definition(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -1005,12 +1009,12 @@ ast_create_definition* parse_create_definition(void) {
  */
 ast_destroy_definition* parse_destroy_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_destroy_definition* node = NULL;
     ast_destroy_name* name;
     bool is_virtual = false;
     ast_function_body* body;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -1045,7 +1049,7 @@ ast_destroy_definition* parse_destroy_definition(void) {
             case 2:
                 // function body or error
                 TRACE("state = %d", state);
-                if(NULL != (body = parse_function_body()))
+                if(NULL != (body = parse_lazy_function_body()))
                     state = 100;
                 else {
                     EXPECTED("function body");
@@ -1093,7 +1097,7 @@ ast_destroy_definition* parse_destroy_definition(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -1107,11 +1111,12 @@ ast_destroy_definition* parse_destroy_definition(void) {
  */
 ast_function_body* parse_function_body(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_function_body* node = NULL;
     ast_function_body_element* nterm;
-    LinkList* list = create_link_list();
-    void* post = post_token_queue();
+    AstBuf buf;
+    init_ast_buf(&buf);
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -1133,7 +1138,7 @@ ast_function_body* parse_function_body(void) {
                 // must be a func body element or a '}' or error
                 TRACE("state = %d", state);
                 if(NULL != (nterm = parse_function_body_element()))
-                    append_link_list(list, nterm); // no state change
+                    add_ast_buf(&buf, nterm); // no state change
                 else if(TOK_CCBRACE == TTYPE) {
                     advance_token();
                     state = 100;
@@ -1149,7 +1154,7 @@ ast_function_body* parse_function_body(void) {
                 TRACE("state = %d", state);
                 finished = true;
                 node = CREATE_AST_NODE(AST_function_body, ast_function_body);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 //finalize_token_queue();
                 finished = true;
                 break;
@@ -1174,7 +1179,7 @@ ast_function_body* parse_function_body(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -1188,10 +1193,10 @@ ast_function_body* parse_function_body(void) {
  */
 ast_start_function* parse_start_function(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_start_function* node = NULL;
     ast_function_body* body;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -1223,7 +1228,7 @@ ast_start_function* parse_start_function(void) {
             case 2:
                 // must be function body or an error
                 TRACE("state = %d", state);
-                if(NULL == (body = parse_function_body())) {
+                if(NULL == (body = parse_lazy_function_body())) {
                     EXPECTED("function body");
                     state = 102;
                 }
@@ -1260,7 +1265,7 @@ ast_start_function* parse_start_function(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -1275,12 +1280,12 @@ ast_start_function* parse_start_function(void) {
 ast_function_assignment* parse_function_assignment(void) {
 
 
-    ENTER;
+    RULE_ENTER;
     ast_function_assignment* node = NULL;
     ast_compound_reference* name;
     ast_type_name_list* inp;
     ast_type_name_list* outp;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     int state = 0;
     bool finished = false;
@@ -1348,5 +1353,5 @@ ast_function_assignment* parse_function_assignment(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
@@ -8,7 +8,9 @@
  * @date 02-26-2024
  * @copyright Copyright (c) 2024
  */
+#include "first_sets.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 #include "trace.h"
 
@@ -33,6 +35,9 @@
  *      / type_statement
  *      / return_statement
  *      / raise_statement
+ *      / trace_statement
+ *      / print_statement
+ *      / exit_statement
  *      / function_body
  *
  * @return ast_function_body_element*
@@ -40,10 +45,15 @@
  */
 ast_function_body_element* parse_function_body_element(void) {
 
-    ENTER;
+    RULE_ENTER;
+    // nothing here can start with this token, but a scanner error is let
+    // through so that parse_inline_statement() can report it
+    if(!CAN_START(function_body_element) && TOK_ERROR != TTYPE)
+        RULE_RETV(NULL);
+
     ast_function_body_element* node = NULL;
     ast_node* nterm;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if((NULL != (nterm = (ast_node*)parse_create_reference())) ||
        (NULL != (nterm = (ast_node*)parse_destroy_reference())) ||
@@ -72,7 +82,7 @@ ast_function_body_element* parse_function_body_element(void) {
     else
         reset_token_queue(post);
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -86,7 +96,7 @@ ast_function_body_element* parse_function_body_element(void) {
  */
 ast_break_statement* parse_break_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_break_statement* node = NULL;
 
     if(TOK_BREAK == TTYPE) {
@@ -94,7 +104,7 @@ ast_break_statement* parse_break_statement(void) {
         node = CREATE_AST_NODE(AST_break_statement, ast_break_statement);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -108,7 +118,7 @@ ast_break_statement* parse_break_statement(void) {
  */
 ast_continue_statement* parse_continue_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_continue_statement* node = NULL;
 
     if(TOK_CONTINUE == TTYPE) {
@@ -116,7 +126,7 @@ ast_continue_statement* parse_continue_statement(void) {
         node = CREATE_AST_NODE(AST_continue_statement, ast_continue_statement);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -130,7 +140,7 @@ ast_continue_statement* parse_continue_statement(void) {
  */
 ast_inline_statement* parse_inline_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_inline_statement* node = NULL;
 
     if(TOK_INLINE == TTYPE) {
@@ -142,7 +152,7 @@ ast_inline_statement* parse_inline_statement(void) {
         show_syntax("%s", tok_to_str(get_token()));
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -156,7 +166,7 @@ ast_inline_statement* parse_inline_statement(void) {
  */
 ast_yield_statement* parse_yield_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_yield_statement* node = NULL;
     ast_compound_reference* ref;
 
@@ -180,7 +190,7 @@ ast_yield_statement* parse_yield_statement(void) {
             EXPECTED("a '('");
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -194,7 +204,7 @@ ast_yield_statement* parse_yield_statement(void) {
  */
 ast_return_statement* parse_return_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_return_statement* node = NULL;
 
     if(TOK_RETURN == TTYPE) {
@@ -202,7 +212,7 @@ ast_return_statement* parse_return_statement(void) {
         node = CREATE_AST_NODE(AST_return_statement, ast_return_statement);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -216,14 +226,14 @@ ast_return_statement* parse_return_statement(void) {
  */
 ast_raise_statement* parse_raise_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_raise_statement* node = NULL;
     Token* symb;
     ast_formatted_strg* str;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -341,7 +351,7 @@ ast_raise_statement* parse_raise_statement(void) {
                     advance_token();
                     if(NULL == (str = parse_formatted_strg())) {
                         EXPECTED("formatted string");
-                        RETV(NULL);
+                        RULE_RETV(NULL);
                     }
                     else if(TOK_CPAREN == TTYPE) {
                         node = CREATE_AST_NODE(AST_raise_statement, ast_raise_statement);
@@ -361,7 +371,7 @@ ast_raise_statement* parse_raise_statement(void) {
             EXPECTED("a '('");
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -374,13 +384,13 @@ ast_raise_statement* parse_raise_statement(void) {
  */
 ast_trace_statement* parse_trace_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_trace_statement* node = NULL;
     ast_string_literal* str;
 
     bool finished = false;
     int state     = 0;
-    void* post    = post_token_queue();
+    TokPost post  = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -459,7 +469,7 @@ ast_trace_statement* parse_trace_statement(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
@@ -473,13 +483,13 @@ ast_trace_statement* parse_trace_statement(void) {
  */
 ast_print_statement* parse_print_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_print_statement* node = NULL;
     ast_expression_list* elist;
 
     bool finished = false;
     int state     = 0;
-    void* post    = post_token_queue();
+    TokPost post  = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -528,7 +538,7 @@ ast_print_statement* parse_print_statement(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -539,13 +549,13 @@ ast_print_statement* parse_print_statement(void) {
  */
 ast_exit_statement* parse_exit_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_exit_statement* node = NULL;
     ast_expression* expr;
 
     bool finished = false;
     int state     = 0;
-    void* post    = post_token_queue();
+    TokPost post  = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -624,6 +634,6 @@ ast_exit_statement* parse_exit_statement(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
@@ -9,45 +9,241 @@
  * @copyright Copyright (c) 2024
  */
 #include "trace.h"
+#include "errors.h"
+#include "fileio.h"
+#include "hash.h"
+#include "import_jobs.h"
+#include "interface.h"
+#include "lazy.h"
+#include "memory.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 #include "paths.h"
 
+// modules that have been parsed, by the real path of the file
+static _Thread_local HashTable* module_cache = NULL;
+static _Thread_local ImportStats import_stats;
+// the entry of a module in the cache while it is being parsed
+static ast_module parsing_module;
+
+static ast_module* import_module(const char* path, SymId name, bool* cached);
+
 /**
- * @brief Convert mod to an openable file name, Open the file. Parse a module.
+ * @brief A module that was loaded from its interface file does not have the
+ * modules that it imports. Find them the same way that the parser would.
  *
- * @param mod
- * @param name
+ * @param module
  *
  */
-static ast_module* handle_import(Token* mod, Token* name) {
+static void resolve_imports(ast_module* module) {
+
+    ENTER;
+    for(int i = 0; i < module->list->len; i++) {
+        ast_module_item* item = module->list->items[i];
+        if(ast_node_type(item->nterm) == AST_import_statement) {
+            ast_import_statement* imp = (ast_import_statement*)item->nterm;
+            const char* path          = raw_string(find_file(token_text(imp->mod)));
+            SymId name                = (imp->name != NULL) ? imp->name->sym : imp->mod->sym;
+            imp->module               = import_module(path, name, &imp->cached);
+        }
+    }
+    RET;
+}
+
+/**
+ * @brief Return true if the tree of a job can be used. The module must have
+ * parsed without errors, and so must everything that it imports that has
+ * not been parsed already, because an error anywhere changes how the parser
+ * goes on after it. A module that imports itself, or one that is being
+ * parsed, is never clean.
+ *
+ * @param job
+ * @return bool
+ *
+ */
+static bool is_clean_job(ImportJob* job) {
+
+    if(job == NULL || job->pool == NULL || job->errors != 0)
+        return false;
+
+    if(job->clean != 0)
+        return job->clean > 0;
+
+    // not clean while its imports are checked
+    job->clean = -1;
+    for(int i = 0; i < job->num_marks; i++) {
+        const char* path = job->imports[i];
+        if(path == NULL)
+            return false;
+        ast_module* module = find_hashtable(module_cache, path);
+        if(module == &parsing_module || (module == NULL && !is_clean_job(wait_import_job(path))))
+            return false;
+    }
+
+    job->clean = 1;
+    return true;
+}
+
+/**
+ * @brief Use the tree of a module that an import thread parsed. The modules
+ * that it imports are handled first, each one where the parse of the job
+ * got to it, and then the tree is loaded and given them.
+ *
+ * @param job
+ * @return ast_module*
+ *
+ */
+static ast_module* load_import_job(ImportJob* job) {
+
+    ENTER;
+    int count            = job->num_marks;
+    ast_module** modules = _ALLOC_ARRAY(ast_module*, count + 1);
+    bool* cached         = _ALLOC_ARRAY(bool, count + 1);
+
+    load_source(job->path);
+    count_skipped_bodies(job->skipped);
+    add_rule_stats(job->rules, job->num_rules);
+    for(int i = 0; i < count; i++) {
+        replay_import_job(job, i - 1, i);
+        modules[i] = import_module(job->imports[i], SYMID_NONE, &cached[i]);
+    }
+    replay_import_job(job, count - 1, count);
+
+    ast_module* module = expand_ast_pool(job->pool);
+    for(int i = 0, mark = 0; module->list != NULL && i < module->list->len && mark < count; i++) {
+        ast_module_item* item = module->list->items[i];
+        if(ast_node_type(item->nterm) == AST_import_statement) {
+            ast_import_statement* imp = (ast_import_statement*)item->nterm;
+            imp->module               = modules[mark];
+            imp->cached               = cached[mark++];
+        }
+    }
+
+    _FREE(modules);
+    _FREE(cached);
+    RETV(module);
+}
+
+/**
+ * @brief Open the file and parse a module. A module is only parsed the
+ * first time that it is imported. Every import after that gets the same
+ * tree and sets cached so that the passes only see the module once. If
+ * interface files are on, the module is loaded from its file when the
+ * source has not changed, and the file is written when it is parsed. If an
+ * import thread parsed the module, its tree is used. A module that is
+ * imported while it is being parsed is a circular import, and is an error.
+ *
+ * @param path the real path of the module
+ * @param name the name that it is imported as
+ * @param cached set if the module was already parsed
+ * @return ast_module*
+ *
+ */
+static ast_module* import_module(const char* path, SymId name, bool* cached) {
 
     ENTER;
     ast_module* module;
 
-    // find the file and open it
-    open_file(raw_string(find_file(raw_string(mod->str))));
+    *cached = false;
+    if(module_cache == NULL)
+        module_cache = create_hashtable();
+
+    module = find_hashtable(module_cache, path);
+    // like a file that is not found, the compile cannot go on
+    if(module == &parsing_module)
+        fatal_error("circular import: %s imports %s", get_fname(), path);
+
+    if(module != NULL) {
+        TRACE("already imported: %s", path);
+        import_stats.cached++;
+        *cached = true;
+        RETV(module);
+    }
+
+    if(get_interface_state() && NULL != (module = load_interface(path))) {
+        import_stats.loaded++;
+        // cached first, so a module that imports this one finds it
+        insert_hashtable(module_cache, path, module);
+        resolve_imports(module);
+        RETV(module);
+    }
+
+    // an import of the module before it is finished is circular
+    insert_hashtable(module_cache, path, &parsing_module);
+
+    // a job was parsed as if there had been no errors before it
+    ImportJob* job = get_recovery_state() ? NULL : find_import_job(path);
+    if(is_clean_job(job)) {
+        import_stats.jobs++;
+        module = load_import_job(job);
+        remove_hashtable(module_cache, path);
+        insert_hashtable(module_cache, path, module);
+        if(get_interface_state())
+            save_interface(path, module);
+        RETV(module);
+    }
+
+    // open the file
+    int errors = get_num_errors();
+    submit_import_scan(path);
+    open_file(path);
 
     // push the name
-    if(name != NULL)
-        push_name(name->str);
-    else
-        push_name(mod->str);
+    push_name(name);
     push_scope(SCOPE_PRIV);
 
     // parse the module
+    bool importing = get_import_state();
     set_import_state(true);
     module = parse_module();
-    set_import_state(false);
+    set_import_state(importing);
     TRACE("scope before return: %s", raw_string(get_compound_name()));
 
     // pop the scope and name
     pop_scope();
     pop_name();
 
+    // a module with errors is parsed again so the errors are reported again
+    import_stats.parsed++;
+    remove_hashtable(module_cache, path);
+    if(module != NULL && errors == get_num_errors()) {
+        insert_hashtable(module_cache, path, module);
+        if(get_interface_state())
+            save_interface(path, module);
+    }
+
     RETV(module);
 }
 
+/**
+ * @brief Convert mod to an openable file name and import the module. On an
+ * import thread, the import is only marked and queued, because the thread
+ * that compiles handles it when it gets the module.
+ *
+ * @param node
+ *
+ */
+static ast_module* handle_import(ast_import_statement* node) {
+
+    RULE_ENTER;
+    Token* mod  = node->mod;
+    Token* name = node->name;
+
+    if(in_import_job()) {
+        String* found = search_file(token_text(mod));
+        mark_import_job((found != NULL) ? raw_string(found) : NULL);
+        if(found != NULL)
+            submit_import_job(raw_string(found));
+        RULE_RETV(NULL);
+    }
+
+    const char* path   = raw_string(find_file(token_text(mod)));
+    ast_module* module = import_module(path, (name != NULL) ? name->sym : mod->sym, &node->cached);
+
+    RULE_RETV(module);
+}
+
 /**
  * @brief The import statement is like a namespace except that it opens a new
  * file and reads from that instead of the current file. When the imported
@@ -64,7 +260,7 @@ static ast_module* handle_import(Token* mod, Token* name) {
  */
 ast_import_statement* parse_import_statement(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_import_statement* node = NULL;
     Token* name = NULL; // optional alternative name
     Token* mod; // module to import
@@ -83,18 +279,65 @@ ast_import_statement* parse_import_statement(void) {
                 }
                 else {
                     EXPECTED(">> a SYMBOL");
-                    return NULL;
+                    RULE_RETV(NULL);
                 }
             }
 
             node = CREATE_AST_NODE(AST_import_statement, ast_import_statement);
             node->mod = mod;
             node->name = name;
-            node->module = handle_import(mod, name);
+            node->module = handle_import(node);
         }
         else
             EXPECTED("<< a SYMBOL");
     }
 
-    RETV(node);
+    RULE_RETV(node);
+}
+
+/**
+ * @brief Queue the modules that are imported at the top of a file, so that
+ * they are parsed while the file is. This is done by an import thread with
+ * a queue of its own, because the names that the scanner reads are
+ * interned, and the thread that compiles must intern them in order.
+ *
+ * @param path the real path of the file
+ *
+ */
+void prefetch_imports(const char* path) {
+
+    ENTER;
+    open_file(path);
+    while(TOK_IMPORT == TTYPE) {
+        advance_token();
+        if(TOK_SYMBOL != TTYPE)
+            break;
+
+        String* found = search_file(token_text(get_token()));
+        if(found != NULL)
+            submit_import_job(raw_string(found));
+        advance_token();
+
+        if(TOK_AS == TTYPE) {
+            advance_token();
+            if(TOK_SYMBOL != TTYPE)
+                break;
+            advance_token();
+        }
+    }
+    close_file();
+
+    RET;
+}
+
+/**
+ * @brief Return the number of modules that were parsed and the number of
+ * imports that used a module that was already parsed.
+ *
+ * @return const ImportStats*
+ *
+ */
+const ImportStats* get_import_stats(void) {
+
+    return &import_stats;
 }
@@ -0,0 +1,514 @@
+/**
+ * @file import_jobs.c
+ *
+ * @brief Import jobs. When a module is opened, the modules that it imports
+ * are handed to a pool of threads that parse them while the module is
+ * parsed. A worker parses one module and does not follow its imports. It
+ * only queues them as more jobs. The tree is handed back in a node pool,
+ * because the nodes and tokens of a worker are in its own arena.
+ *
+ * The warnings of a worker are saved in a log with a mark at each import,
+ * and so are the names that it interned. When the thread that compiles gets
+ * to the import, it goes through the log up to each mark before it handles
+ * the import there. The messages come out and the names get their IDs in
+ * the same order as when one thread parses everything, so nothing that the
+ * compiler prints depends on which thread parsed what.
+ *
+ * After a syntax error the parser stops backing up for the rest of the
+ * compile, so what it does next depends on everything that was parsed
+ * before. A job is therefore parsed as if there had been no errors yet, and
+ * the thread that compiles only uses it when that is true and when neither
+ * the module nor anything that it imports has errors. Otherwise it parses
+ * the module itself, the same as without the jobs.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <pthread.h>
+#include <string.h>
+
+#include "hash.h"
+#include "import_jobs.h"
+#include "intern.h"
+#include "lazy.h"
+#include "memo.h"
+#include "memory.h"
+#include "parse.h"
+#include "parse_stats.h"
+#include "scanner.h"
+#include "trace.h"
+
+/*
+ * The threads and their queue. Only the fields after the lock are changed
+ * once the threads are started, and only while it is held.
+ */
+typedef struct {
+    pthread_t* threads;
+    int num_threads;
+    bool memo;              // the parser settings of the thread that compiles
+    bool lazy;
+    bool stats;
+    pthread_mutex_t lock;
+    pthread_cond_t queued;  // a job was queued or the threads are stopping
+    pthread_cond_t done;    // a job was finished
+    ImportJob* head;
+    ImportJob* tail;
+    ImportJob* all;
+    HashTable* jobs;        // every job by its path
+    bool stopping;
+} ImportPool;
+
+// the thread that compiles and its workers all point to the same pool
+static _Thread_local ImportPool* import_pool = NULL;
+// the job that a worker is parsing, NULL on the thread that compiles
+static _Thread_local ImportJob* current_job = NULL;
+
+/**
+ * @brief Wait for a job to be queued and take it off of the queue. NULL is
+ * returned when the threads are stopping.
+ *
+ * @return ImportJob*
+ */
+static ImportJob* next_job(void) {
+
+    ImportJob* job = NULL;
+
+    pthread_mutex_lock(&import_pool->lock);
+    while(import_pool->head == NULL && !import_pool->stopping)
+        pthread_cond_wait(&import_pool->queued, &import_pool->lock);
+
+    if(!import_pool->stopping) {
+        job               = import_pool->head;
+        import_pool->head = job->next;
+        if(import_pool->head == NULL)
+            import_pool->tail = NULL;
+    }
+    pthread_mutex_unlock(&import_pool->lock);
+
+    return job;
+}
+
+/**
+ * @brief Copy the text of the names that the job interned into the job, and
+ * change the marks from a number of names to where they are in the text.
+ *
+ * @param job
+ */
+static void save_names(ImportJob* job) {
+
+    int count;
+    const SymId* ids = finish_intern_log(&count);
+
+    size_t len = 0;
+    for(int i = 0; i < count; i++)
+        len += interned_len(ids[i]) + 1;
+
+    job->names     = _ALLOC(len);
+    job->names_len = len;
+
+    int mark   = 0;
+    size_t pos = 0;
+    for(int i = 0; i <= count; i++) {
+        while(mark < job->num_marks && job->name_marks[mark] == (size_t)i)
+            job->name_marks[mark++] = pos;
+        if(i < count) {
+            size_t n = interned_len(ids[i]) + 1;
+            memcpy(&job->names[pos], interned_str(ids[i]), n);
+            pos += n;
+        }
+    }
+}
+
+/**
+ * @brief Give the results of a job to the thread that compiles.
+ *
+ * @param job
+ * @param pool
+ * @param log
+ * @param errors
+ */
+static void finish_job(ImportJob* job, AstPool* pool, ErrorLog* log, int errors) {
+
+    pthread_mutex_lock(&import_pool->lock);
+    job->pool   = pool;
+    job->log    = log;
+    job->errors = errors;
+    job->done   = true;
+    pthread_cond_broadcast(&import_pool->done);
+    pthread_mutex_unlock(&import_pool->lock);
+}
+
+/**
+ * @brief Parse the module of a job and pack the tree.
+ *
+ * @param job
+ */
+static void parse_job(ImportJob* job) {
+
+    ENTER;
+    TRACE("import job: %s", job->path);
+    // before the logs, so that it does not change the order of the names
+    prefetch_imports(job->path);
+    if(job->scan) {
+        finish_job(job, NULL, NULL, 0);
+        RET;
+    }
+
+    current_job = job;
+    start_error_log();
+    start_intern_log();
+    set_recovery_state(false);
+    int errors            = get_num_errors();
+    unsigned long skipped = get_lazy_stats()->skipped;
+
+    open_file(job->path);
+    push_scope(SCOPE_PRIV);
+    set_import_state(true);
+    ast_module* module = parse_module();
+    set_import_state(false);
+    pop_scope();
+
+    // parse_module() leaves the file open if it fails
+    if(module == NULL)
+        close_file();
+
+    AstPool* pool = (module != NULL) ? pack_ast(module) : NULL;
+    ErrorLog* log = finish_error_log();
+    save_names(job);
+    job->skipped = get_lazy_stats()->skipped - skipped;
+    if(parse_stats_state)
+        job->rules = take_rule_stats(&job->num_rules);
+    current_job = NULL;
+
+    finish_job(job, pool, log, get_num_errors() - errors);
+    RET;
+}
+
+/**
+ * @brief The main function of a worker. The parser of the thread is set up
+ * like the one of the thread that compiles, and everything that it
+ * allocated in the arena is freed when it stops.
+ *
+ * @param pool
+ * @return void*
+ */
+static void* import_worker(void* pool) {
+
+    import_pool = pool;
+    INIT_TRACE;
+    set_memo_state(import_pool->memo);
+    set_lazy_state(import_pool->lazy);
+    set_parse_stats(import_pool->stats);
+    init_parser_thread();
+
+    ImportJob* job;
+    while(NULL != (job = next_job()))
+        parse_job(job);
+
+    destroy_compile_arena();
+    return NULL;
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Start the threads that parse imported modules. The memo, lazy, and
+ * parser statistics settings must be made before this. With fewer than two threads the
+ * imports are parsed as they are found, the same as without this.
+ *
+ * @param threads
+ */
+void start_import_jobs(int threads) {
+
+    ENTER;
+    if(threads < 2 || import_pool != NULL)
+        RET;
+
+    ImportPool* pool = _ALLOC_T(ImportPool);
+    pool->threads    = _ALLOC_ARRAY(pthread_t, threads);
+    pool->memo       = get_memo_state();
+    pool->lazy       = get_lazy_state();
+    pool->stats      = parse_stats_state;
+    pool->jobs       = create_hashtable();
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->queued, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for(int i = 0; i < threads; i++) {
+        if(pthread_create(&pool->threads[i], NULL, import_worker, pool) != 0)
+            fatal_error("cannot start an import thread");
+        pool->num_threads++;
+    }
+
+    import_pool = pool;
+    RET;
+}
+
+/**
+ * @brief Stop the threads and free the jobs. Jobs that were not started are
+ * dropped.
+ *
+ */
+void stop_import_jobs(void) {
+
+    ENTER;
+    ImportPool* pool = import_pool;
+    if(pool == NULL || current_job != NULL)
+        RET;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->queued);
+    pthread_mutex_unlock(&pool->lock);
+
+    for(int i = 0; i < pool->num_threads; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    for(ImportJob* job = pool->all, *next; job != NULL; job = next) {
+        next = job->link;
+        if(job->pool != NULL)
+            destroy_ast_pool(job->pool);
+        destroy_error_log(job->log);
+        for(int i = 0; i < job->num_marks; i++)
+            _FREE(job->imports[i]);
+        _FREE(job->imports);
+        _FREE(job->name_marks);
+        _FREE(job->marks);
+        _FREE(job->names);
+        _FREE(job->rules);
+        _FREE(job->path);
+        _FREE(job);
+    }
+
+    destroy_hashtable(pool->jobs);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->queued);
+    pthread_mutex_destroy(&pool->lock);
+    _FREE(pool->threads);
+    _FREE(pool);
+
+    import_pool = NULL;
+    RET;
+}
+
+/**
+ * @brief Return true if imported modules are parsed by the import threads.
+ *
+ * @return bool
+ */
+bool import_jobs_running(void) {
+
+    return import_pool != NULL;
+}
+
+/**
+ * @brief Return true if this thread is parsing a module for an import job.
+ *
+ * @return bool
+ */
+bool in_import_job(void) {
+
+    return current_job != NULL;
+}
+
+/**
+ * @brief Add a job to the list of all of them and to the end of the queue.
+ * The lock must be held.
+ *
+ * @param pool
+ * @param path
+ * @return ImportJob*
+ */
+static ImportJob* queue_job(ImportPool* pool, const char* path) {
+
+    ImportJob* job = _ALLOC_T(ImportJob);
+    job->path      = _DUP_STR(path);
+    job->link      = pool->all;
+    pool->all      = job;
+
+    if(pool->tail != NULL)
+        pool->tail->next = job;
+    else
+        pool->head = job;
+    pool->tail = job;
+    pthread_cond_signal(&pool->queued);
+
+    return job;
+}
+
+/**
+ * @brief Queue a module to be parsed, if it has not been already.
+ *
+ * @param path the real path of the module
+ */
+void submit_import_job(const char* path) {
+
+    ENTER;
+    ImportPool* pool = import_pool;
+    if(pool == NULL)
+        RET;
+
+    pthread_mutex_lock(&pool->lock);
+    if(!pool->stopping && find_hashtable(pool->jobs, path) == NULL) {
+        insert_hashtable(pool->jobs, path, queue_job(pool, path));
+        TRACE("queued: %s", path);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    RET;
+}
+
+/**
+ * @brief Queue the imports of a module that the thread that compiles is
+ * about to parse, so that they are parsed while it does.
+ *
+ * @param path the real path of the module
+ */
+void submit_import_scan(const char* path) {
+
+    ENTER;
+    ImportPool* pool = import_pool;
+    if(pool == NULL)
+        RET;
+
+    pthread_mutex_lock(&pool->lock);
+    if(!pool->stopping)
+        queue_job(pool, path)->scan = true;
+    pthread_mutex_unlock(&pool->lock);
+
+    RET;
+}
+
+/**
+ * @brief In a worker, save where the log is at an import in the module and
+ * what it imports, so that the thread that compiles handles the import
+ * after the messages before it are printed.
+ *
+ * @param path the real path of the module that is imported, or NULL
+ */
+void mark_import_job(const char* path) {
+
+    ImportJob* job = current_job;
+    if(job == NULL)
+        return;
+
+    if(job->num_marks + 1 > job->cap_marks) {
+        job->cap_marks = (job->cap_marks == 0) ? 0x10 : job->cap_marks << 1;
+        job->marks      = _REALLOC_ARRAY(job->marks, size_t, job->cap_marks);
+        job->name_marks = _REALLOC_ARRAY(job->name_marks, size_t, job->cap_marks);
+        job->imports    = _REALLOC_ARRAY(job->imports, char*, job->cap_marks);
+    }
+    job->marks[job->num_marks]      = mark_error_log();
+    job->name_marks[job->num_marks] = (size_t)mark_intern_log();
+    job->imports[job->num_marks]    = (path != NULL) ? _DUP_STR(path) : NULL;
+    job->num_marks++;
+}
+
+/**
+ * @brief Find the job of a module and wait for it to finish. If take is
+ * set and no worker has started the job, it is taken off of the queue
+ * instead and its pool is NULL.
+ *
+ * @param path
+ * @param take
+ * @return ImportJob*
+ */
+static ImportJob* get_import_job(const char* path, bool take) {
+
+    ImportPool* pool = import_pool;
+    if(pool == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    ImportJob* job = find_hashtable(pool->jobs, path);
+    if(job != NULL && !job->done) {
+        ImportJob* prev = NULL;
+        ImportJob* crnt = pool->head;
+        while(take && crnt != NULL && crnt != job) {
+            prev = crnt;
+            crnt = crnt->next;
+        }
+
+        if(take && crnt == job) {
+            if(prev != NULL)
+                prev->next = job->next;
+            else
+                pool->head = job->next;
+            if(pool->tail == job)
+                pool->tail = prev;
+            job->next = NULL;
+            job->done = true;
+        }
+        else {
+            pause_rule_stats();
+            while(!job->done)
+                pthread_cond_wait(&pool->done, &pool->lock);
+            resume_rule_stats();
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return job;
+}
+
+/**
+ * @brief Return the job of a module when it is finished. NULL is returned
+ * if the module was never queued. If no worker has started the job, it is
+ * taken off of the queue and its pool is NULL, because the thread that
+ * compiles can parse it as soon as anything can.
+ *
+ * @param path the real path of the module
+ * @return ImportJob*
+ */
+ImportJob* find_import_job(const char* path) {
+
+    ENTER;
+    ImportJob* job = get_import_job(path, true);
+    RETV(job);
+}
+
+/**
+ * @brief Return the job of a module when it is finished, without taking it.
+ *
+ * @param path the real path of the module
+ * @return ImportJob*
+ */
+ImportJob* wait_import_job(const char* path) {
+
+    ENTER;
+    ImportJob* job = get_import_job(path, false);
+    RETV(job);
+}
+
+/**
+ * @brief On the thread that compiles, do what the parse of a job did
+ * between two of its imports. The names that it found are interned and its
+ * messages are printed. An index of -1 is the start of the module and the
+ * number of marks is the end of it.
+ *
+ * @param job
+ * @param from
+ * @param to
+ */
+void replay_import_job(const ImportJob* job, int from, int to) {
+
+    ENTER;
+    size_t end_log = (job->log != NULL) ? job->log->len : 0;
+
+    size_t pos = (from < 0) ? 0 : (from < job->num_marks) ? job->name_marks[from] : job->names_len;
+    size_t end = (to < job->num_marks) ? job->name_marks[to] : job->names_len;
+    while(pos < end) {
+        intern_str(&job->names[pos]);
+        pos += strlen(&job->names[pos]) + 1;
+    }
+
+    pos = (from < 0) ? 0 : (from < job->num_marks) ? job->marks[from] : end_log;
+    end = (to < job->num_marks) ? job->marks[to] : end_log;
+    replay_error_log(job->log, pos, end);
+
+    RET;
+}
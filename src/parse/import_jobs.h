@@ -0,0 +1,62 @@
+/**
+ * @file import_jobs.h
+ *
+ * @brief Public interface to the import jobs. The modules that a module
+ * imports are parsed ahead of time on a pool of threads. The thread that
+ * compiles picks up the results in the same order that it would have
+ * parsed them itself.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _IMPORT_JOBS_H_
+#define _IMPORT_JOBS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "errors.h"
+#include "parse_stats.h"
+#include "pool.h"
+
+/*
+ * One imported module. Everything in it belongs to the thread that
+ * compiles once done is set. If pool is NULL then that thread parses the
+ * module itself.
+ */
+typedef struct _import_job_ {
+    char* path;                // real path of the module
+    bool scan;                 // only queue the imports of the module
+    AstPool* pool;             // the tree of the module, NULL if it did not parse
+    ErrorLog* log;             // the messages of the parse
+    int errors;                // syntax errors in the log
+    unsigned long skipped;     // function bodies that the parse skipped
+    RuleStats* rules;          // the counts of the parser rules, NULL without --parse-stats
+    int num_rules;
+    bool done;                 // the pool and the log are ready
+    int clean;                 // see is_clean_job() in import.c
+    char* names;               // the names that the parse interned, in order
+    size_t names_len;
+    size_t* marks;             // where the log was at each import in the module
+    size_t* name_marks;        // where the names were at each import
+    char** imports;            // the real path of each import, NULL if not found
+    int num_marks;
+    int cap_marks;
+    struct _import_job_* next; // next job in the queue
+    struct _import_job_* link; // every job, to free them
+} ImportJob;
+
+void start_import_jobs(int threads);
+void stop_import_jobs(void);
+bool import_jobs_running(void);
+bool in_import_job(void);
+void submit_import_job(const char* path);
+void submit_import_scan(const char* path);
+void mark_import_job(const char* path);
+ImportJob* find_import_job(const char* path);
+ImportJob* wait_import_job(const char* path);
+void replay_import_job(const ImportJob* job, int from, int to);
+
+#endif /* _IMPORT_JOBS_H_ */
@@ -0,0 +1,229 @@
+/**
+ * @file interface.c
+ *
+ * @brief Module interface files. When a module is imported, its tree can be
+ * saved in a file next to the source, with the size and a hash of the
+ * source that it was parsed from. The next compile that imports the module
+ * loads the tree from the file if the source is still the same, and parses
+ * it if not.
+ *
+ * A file only holds the tree of its own module. The modules that it imports
+ * are cut out when it is written, and the import that loads it finds them
+ * again, so each file is checked against its own source.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "fileio.h"
+#include "interface.h"
+#include "lazy.h"
+#include "memory.h"
+#include "pool.h"
+#include "trace.h"
+
+static _Thread_local bool interface_enabled = false;
+
+/**
+ * @brief Make the name of the interface file of a source file. The ".k" is
+ * replaced if there is one.
+ *
+ * @param path
+ * @param buf
+ * @return bool false if the name is too long
+ */
+static bool interface_name(const char* path, char* buf) {
+
+    size_t len = strlen(path);
+    if(len >= 2 && !strcmp(&path[len - 2], ".k"))
+        len -= 2;
+
+    if(len + sizeof(INTERFACE_EXT) > PATH_MAX)
+        return false;
+
+    memcpy(buf, path, len);
+    strcpy(&buf[len], INTERFACE_EXT);
+    return true;
+}
+
+/**
+ * @brief FNV-1a over the text of a source file.
+ *
+ * @param buf
+ * @param len
+ * @return uint64_t
+ */
+static uint64_t hash_source(const unsigned char* buf, size_t len) {
+
+    uint64_t hash = 14695981039346656037u;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= buf[i];
+        hash *= 1099511628211u;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Return true if the source is the same as when the interface file
+ * was written.
+ *
+ * @param mi
+ * @param path
+ * @return bool
+ */
+static bool is_current(const ModuleInterface* mi, const char* path) {
+
+    int id      = load_source(path);
+    size_t size = get_source_size(id);
+
+    return mi->source_size == size && mi->source_hash == hash_source(get_source_text(id), size);
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Turn the interface files on or off. They are off by default.
+ *
+ * @param state
+ */
+void set_interface_state(bool state) {
+
+    interface_enabled = state;
+}
+
+/**
+ * @brief Return true if the interface files are used.
+ *
+ * @return bool
+ */
+bool get_interface_state(void) {
+
+    return interface_enabled;
+}
+
+/**
+ * @brief Load the tree of a module from its interface file. NULL is
+ * returned if there is no file, if it was written by a different program,
+ * if it has no function bodies and lazy bodies are off, or if the source
+ * has changed since. The imports in the tree do not have
+ * their modules yet.
+ *
+ * @param path the real path of the source
+ * @return ast_module*
+ */
+ast_module* load_interface(const char* path) {
+
+    ENTER;
+    char iname[PATH_MAX];
+    struct stat st;
+
+    if(!interface_name(path, iname))
+        RETV(NULL);
+
+    FILE* fp = fopen(iname, "rb");
+    if(fp == NULL)
+        RETV(NULL);
+
+    if(fstat(fileno(fp), &st) != 0 || st.st_size < (off_t)(sizeof(ModuleInterface) + sizeof(AstPool))) {
+        fclose(fp);
+        RETV(NULL);
+    }
+
+    ModuleInterface* mi = _ALLOC((size_t)st.st_size);
+    size_t len          = fread(mi, 1, (size_t)st.st_size, fp);
+    fclose(fp);
+
+    ast_module* module = NULL;
+    // a tree without its function bodies is only good if they are not wanted
+    if(len == (size_t)st.st_size && mi->magic == INTERFACE_MAGIC && mi->version == INTERFACE_VERSION &&
+            (!(mi->flags & INTERFACE_LAZY) || get_lazy_state()) && is_current(mi, path)) {
+        const AstPool* pool = map_ast_pool(mi + 1, len - sizeof(ModuleInterface));
+        if(pool != NULL)
+            module = expand_ast_pool(pool);
+    }
+
+    TRACE("%s: %s", iname, (module != NULL) ? "loaded" : "out of date");
+    _FREE(mi);
+
+    RETV(module);
+}
+
+/**
+ * @brief Write the interface file of a module that was just parsed. The
+ * file is written under a temporary name and then renamed, so a compile
+ * that reads it never sees part of a file. If the file cannot be written,
+ * the module is simply parsed again the next time.
+ *
+ * @param path the real path of the source
+ * @param module
+ */
+void save_interface(const char* path, ast_module* module) {
+
+    ENTER;
+    char iname[PATH_MAX];
+    char tname[PATH_MAX + 8];
+    int id = find_source_file(path);
+
+    if(id < 0 || module->list == NULL || !interface_name(path, iname))
+        RET;
+
+    // the imported modules have files of their own
+    AstList* list      = module->list;
+    ast_module** saved = _ALLOC_ARRAY(ast_module*, list->len);
+    for(int i = 0; i < list->len; i++) {
+        ast_module_item* item = list->items[i];
+        if(ast_node_type(item->nterm) == AST_import_statement) {
+            ast_import_statement* imp = (ast_import_statement*)item->nterm;
+            saved[i]                  = imp->module;
+            imp->module               = NULL;
+        }
+    }
+
+    AstPool* pool = pack_ast(module);
+
+    for(int i = 0; i < list->len; i++) {
+        ast_module_item* item = list->items[i];
+        if(ast_node_type(item->nterm) == AST_import_statement)
+            ((ast_import_statement*)item->nterm)->module = saved[i];
+    }
+    _FREE(saved);
+
+    ModuleInterface mi;
+    mi.magic       = INTERFACE_MAGIC;
+    mi.version     = INTERFACE_VERSION;
+    mi.source_size = get_source_size(id);
+    mi.source_hash = hash_source(get_source_text(id), mi.source_size);
+    mi.flags       = get_lazy_state() ? INTERFACE_LAZY : 0;
+    mi.unused      = 0;
+
+    snprintf(tname, sizeof(tname), "%s.XXXXXX", iname);
+    int fd = mkstemp(tname);
+    if(fd >= 0)
+        fchmod(fd, 0644); // mkstemp() makes it private
+    FILE* fp = (fd >= 0) ? fdopen(fd, "wb") : NULL;
+    if(fp != NULL) {
+        bool ok = fwrite(&mi, sizeof(mi), 1, fp) == 1 && fwrite(pool, 1, pool->size, fp) == pool->size;
+        ok      = (fclose(fp) == 0) && ok;
+        if(!ok || rename(tname, iname) != 0)
+            unlink(tname);
+        TRACE("%s: %s", iname, ok ? "written" : "not written");
+    }
+    else if(fd >= 0) {
+        close(fd);
+        unlink(tname);
+    }
+
+    destroy_ast_pool(pool);
+    RET;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file interface.h
+ *
+ * @brief Public interface to the module interface files. An interface file
+ * is written next to the source of an imported module and holds the tree
+ * of the module in a node pool. When the source has not changed, an import
+ * loads the file instead of parsing the module again.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _INTERFACE_H_
+#define _INTERFACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ast.h"
+
+#define INTERFACE_MAGIC 0x46494d4b // "KMIF"
+#define INTERFACE_VERSION 2
+#define INTERFACE_EXT ".ki"
+
+// the function bodies were skipped, see lazy.c
+#define INTERFACE_LAZY 0x01
+
+/*
+ * The file is this header and then an AstPool. The pool checks that the
+ * file was written by a program with the same AST structs.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t source_size; // bytes in the source when the file was written
+    uint64_t source_hash; // FNV-1a of the source when the file was written
+    uint32_t flags;
+    uint32_t unused;
+} ModuleInterface;
+
+void set_interface_state(bool state);
+bool get_interface_state(void);
+ast_module* load_interface(const char* path);
+void save_interface(const char* path, ast_module* module);
+
+#endif /* _INTERFACE_H_ */
@@ -0,0 +1,163 @@
+/**
+ * @file lazy.c
+ *
+ * @brief Lazy function bodies. An imported module is only needed for what
+ * it declares, so when this is turned on the body of a function definition
+ * in an imported module is not parsed. The tokens are read up to the brace
+ * that matches the opening one, which costs little more than scanning them,
+ * and the node of the body keeps the '{' and where the body is in the
+ * source. load_function_body() opens that part of the source again and
+ * parses it. The bodies pass in bodypass.c does that for a pass that
+ * needs the bodies.
+ *
+ * A body that is skipped is not checked until it is parsed, so its syntax
+ * errors are reported then, if ever. If the braces do not match, the body
+ * is parsed right away so that the error is reported where it is.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include "lazy.h"
+#include "parse.h"
+#include "parse_stats.h"
+#include "scanner.h"
+#include "trace.h"
+
+static _Thread_local bool lazy_enabled = false;
+static _Thread_local LazyStats lazy_stats;
+
+/**
+ * @brief Read the tokens of a function body up to the matching '}' and
+ * make a node that says where it is.
+ *
+ * @return ast_function_body*
+ */
+static ast_function_body* skip_function_body(void) {
+
+    RULE_ENTER;
+    if(TOK_OCBRACE != TTYPE)
+        RULE_RETV(NULL);
+
+    TokPost post = post_token_queue();
+    Token* open  = get_token();
+    int depth    = 0;
+
+    while(true) {
+        TokenType type = TTYPE;
+        if(TOK_OCBRACE == type)
+            depth++;
+        else if(TOK_CCBRACE == type && --depth == 0)
+            break;
+        else if(TOK_END_OF_FILE == type || TOK_END_OF_INPUT == type) {
+            // the parser says what is wrong with it
+            reset_token_queue(post);
+            ast_function_body* node = parse_function_body();
+            RULE_RETV(node);
+        }
+        advance_token();
+    }
+
+    Token* close = get_token();
+    advance_token();
+
+    ast_function_body* node = CREATE_AST_NODE(AST_function_body, ast_function_body);
+    node->lazy              = open;
+    node->lazy_offset       = (int)open->offset;
+    node->lazy_end          = (int)(close->offset + close->len);
+    lazy_stats.skipped++;
+
+    RULE_RETV(node);
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Turn the lazy function bodies on or off. They are off by default.
+ *
+ * @param state
+ */
+void set_lazy_state(bool state) {
+
+    lazy_enabled = state;
+}
+
+/**
+ * @brief Return true if the function bodies of imported modules are skipped.
+ *
+ * @return bool
+ */
+bool get_lazy_state(void) {
+
+    return lazy_enabled;
+}
+
+/**
+ * @brief Parse the body of a function definition. In a module that is being
+ * imported, the body is skipped if lazy bodies are turned on.
+ *
+ * @return ast_function_body*
+ */
+ast_function_body* parse_lazy_function_body(void) {
+
+    if(lazy_enabled && get_import_state())
+        return skip_function_body();
+
+    return parse_function_body();
+}
+
+/**
+ * @brief Parse a function body that was skipped. The node is filled in
+ * where it is, so the tree does not change shape. A body that was parsed
+ * before is returned as it is.
+ *
+ * @param node
+ * @return ast_function_body*
+ */
+ast_function_body* load_function_body(ast_function_body* node) {
+
+    ENTER;
+    if(node == NULL || node->lazy == NULL)
+        RETV(node);
+
+    Token* open = node->lazy;
+    if(open->file_id < 0)
+        fatal_error("the source of a function body at %d:%d is not loaded", open->line_no, open->col_no);
+
+    open_source_range(open->file_id, (size_t)node->lazy_offset, (size_t)node->lazy_end, open->line_no,
+                      open->col_no);
+    ast_function_body* body = parse_function_body();
+    close_file();
+
+    node->list        = (body != NULL) ? body->list : NULL;
+    node->lazy        = NULL;
+    node->lazy_offset = 0;
+    node->lazy_end    = 0;
+    lazy_stats.loaded++;
+
+    RETV(node);
+}
+
+/**
+ * @brief Count the bodies that an import thread skipped in a module, when
+ * its tree is used. The thread has stats of its own.
+ *
+ * @param count
+ */
+void count_skipped_bodies(unsigned long count) {
+
+    lazy_stats.skipped += count;
+}
+
+/**
+ * @brief Return the number of bodies that were skipped and parsed later.
+ *
+ * @return const LazyStats*
+ */
+const LazyStats* get_lazy_stats(void) {
+
+    return &lazy_stats;
+}
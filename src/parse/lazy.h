@@ -0,0 +1,32 @@
+/**
+ * @file lazy.h
+ *
+ * @brief Public interface to the lazy function bodies. When a module is
+ * imported, the bodies of its functions can be skipped over by matching the
+ * braces, and parsed later if something needs them.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _LAZY_H_
+#define _LAZY_H_
+
+#include <stdbool.h>
+
+#include "ast.h"
+
+typedef struct {
+    unsigned long skipped; // bodies that were skipped when they were imported
+    unsigned long loaded;  // skipped bodies that were parsed later
+} LazyStats;
+
+void set_lazy_state(bool state);
+bool get_lazy_state(void);
+ast_function_body* parse_lazy_function_body(void);
+ast_function_body* load_function_body(ast_function_body* node);
+void count_skipped_bodies(unsigned long count);
+const LazyStats* get_lazy_stats(void);
+
+#endif /* _LAZY_H_ */
@@ -12,6 +12,7 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -26,14 +27,15 @@
  */
 ast_list_init* parse_list_init(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_list_init* node = NULL;
     ast_node* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -53,11 +55,11 @@ ast_list_init* parse_list_init(void) {
                 // a list or a dictionary
                 TRACE("state = %d", state);
                 if(NULL != (nterm = (ast_node*)parse_dict_init_element())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 5;
                 }
                 else if(NULL != (nterm = (ast_node*)parse_assignment_item())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 3;
                 }
                 else {
@@ -71,7 +73,7 @@ ast_list_init* parse_list_init(void) {
                 // a list or a dictionary
                 TRACE("state = %d", state);
                 if(NULL != (nterm = (ast_node*)parse_assignment_item())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 3;
                 }
                 else {
@@ -105,7 +107,7 @@ ast_list_init* parse_list_init(void) {
                 // a list or a dictionary
                 TRACE("state = %d", state);
                 if(NULL != (nterm = (ast_node*)parse_dict_init_element())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 5;
                 }
                 else {
@@ -135,7 +137,7 @@ ast_list_init* parse_list_init(void) {
                 // completed parse for list init
                 TRACE("state = %d", state);
                 node = CREATE_AST_NODE(AST_list_init, ast_list_init);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -143,7 +145,7 @@ ast_list_init* parse_list_init(void) {
                 // completed parse for dict init
                 TRACE("state = %d", state);
                 node = (ast_list_init*)CREATE_AST_NODE(AST_dict_init, ast_dict_init);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -166,7 +168,7 @@ ast_list_init* parse_list_init(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -180,14 +182,14 @@ ast_list_init* parse_list_init(void) {
  */
 ast_dict_init_element* parse_dict_init_element(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_dict_init_element* node = NULL;
     Token* key;
     ast_assignment_item* item;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -256,7 +258,7 @@ ast_dict_init_element* parse_dict_init_element(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -270,13 +272,13 @@ ast_dict_init_element* parse_dict_init_element(void) {
  */
 ast_array_param* parse_array_param(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_array_param* node = NULL;
     ast_node* nterm;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -346,7 +348,7 @@ ast_array_param* parse_array_param(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -360,14 +362,15 @@ ast_array_param* parse_array_param(void) {
  */
 ast_array_param_list* parse_array_param_list(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_array_param_list* node = NULL;
     ast_array_param* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -375,7 +378,7 @@ ast_array_param_list* parse_array_param_list(void) {
                 // must be an expression or a string_expression or an error
                 TRACE("state = %d", state);
                 if(NULL != (nterm = parse_array_param())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 1;
                 }
                 else {
@@ -387,7 +390,7 @@ ast_array_param_list* parse_array_param_list(void) {
                 // must be an expression or a string_expression or an error
                 TRACE("state = %d", state);
                 if(NULL != (nterm = parse_array_param())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                 }
                 else {
                     state = 100;
@@ -398,7 +401,7 @@ ast_array_param_list* parse_array_param_list(void) {
                 // completed parse
                 TRACE("state = %d", state);
                 node = CREATE_AST_NODE(AST_array_param_list, ast_array_param_list);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -421,7 +424,7 @@ ast_array_param_list* parse_array_param_list(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 #if 0
@@ -436,14 +439,14 @@ ast_array_param_list* parse_array_param_list(void) {
  */
 ast_array_reference* parse_array_reference(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_array_reference* node = NULL;
     Token* symbol;
     ast_array_param_list* param;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -497,7 +500,7 @@ ast_array_reference* parse_array_reference(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 #endif
 
@@ -12,6 +12,7 @@
 
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -27,9 +28,9 @@
  */
 ast_scope_operator* parse_scope_operator(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_scope_operator* node = NULL;
-    TokenType ttype = token_type(get_token());
+    TokenType ttype = TTYPE;
 
     if((TOK_PRIVATE == ttype) ||
             (TOK_PUBLIC == ttype) ||
@@ -45,7 +46,7 @@ ast_scope_operator* parse_scope_operator(void) {
         advance_token();
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -67,9 +68,9 @@ ast_scope_operator* parse_scope_operator(void) {
  */
 ast_literal_type_name* parse_literal_type_name(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_literal_type_name* node = NULL;
-    TokenType ttype = token_type(get_token());
+    TokenType ttype = TTYPE;
 
     if((TOK_FLOAT == ttype) ||
             (TOK_UNSIGNED == ttype) ||
@@ -87,7 +88,7 @@ ast_literal_type_name* parse_literal_type_name(void) {
         advance_token();
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 // TODO: Make funciton match production
@@ -106,9 +107,9 @@ ast_literal_type_name* parse_literal_type_name(void) {
  */
 ast_literal_value* parse_literal_value(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_literal_value* node = NULL;
-    TokenType ttype = token_type(get_token());
+    TokenType ttype = TTYPE;
     ast_string_literal* str;
 
     if((TOK_LITERAL_FLOAT == ttype) ||
@@ -127,13 +128,13 @@ ast_literal_value* parse_literal_value(void) {
 
         switch(ttype) {
             case TOK_LITERAL_FLOAT:
-                node->value.fnum = strtod(raw_string(get_token()->str), NULL);
+                node->value.fnum = strtod(token_text(get_token()), NULL);
                 break;
             case TOK_LITERAL_SIGNED:
-                node->value.snum = strtol(raw_string(get_token()->str), NULL, 10);
+                node->value.snum = strtol(token_text(get_token()), NULL, 10);
                 break;
             case TOK_LITERAL_UNSIGNED:
-                node->value.unum = strtol(raw_string(get_token()->str), NULL, 16);
+                node->value.unum = strtol(token_text(get_token()), NULL, 16);
                 break;
             case TOK_TRUE:
             case TOK_ON:
@@ -156,7 +157,7 @@ ast_literal_value* parse_literal_value(void) {
     }
     // else not a match
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -171,7 +172,7 @@ ast_literal_value* parse_literal_value(void) {
  */
 ast_type_name* parse_type_name(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_type_name* node = NULL;
     ast_node* nterm;
 
@@ -181,10 +182,9 @@ ast_type_name* parse_type_name(void) {
         TRACE_TERM(get_token());
         node = CREATE_AST_NODE(AST_type_name, ast_type_name);
         node->nterm = nterm;
-        finalize_token_queue();
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -198,10 +198,11 @@ ast_type_name* parse_type_name(void) {
  */
 ast_type_name_list* parse_type_name_list(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_type_name_list* node = NULL;
     ast_node* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
 
     int state = 0;
     bool finished = false;
@@ -221,7 +222,7 @@ ast_type_name_list* parse_type_name_list(void) {
             case 1:
                 // can be a type name or a ')'
                 if(NULL != (nterm = (ast_node*)parse_type_name())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 2;
                 }
                 else if(TOK_CPAREN == TTYPE) {
@@ -253,7 +254,7 @@ ast_type_name_list* parse_type_name_list(void) {
             case 3:
                 // must be a type name or error
                 if(NULL != (nterm = (ast_node*)parse_type_name())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 2;
                 }
                 else {
@@ -265,8 +266,7 @@ ast_type_name_list* parse_type_name_list(void) {
             case 100:
                 // finished parsing non-terminal
                 node = CREATE_AST_NODE(AST_type_name_list, ast_type_name_list);
-                node->list = list;
-                finalize_token_queue();
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -287,6 +287,6 @@ ast_type_name_list* parse_type_name_list(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
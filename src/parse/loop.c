@@ -10,6 +10,7 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -23,13 +24,13 @@
  */
 ast_while_definition* parse_while_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_while_definition* node = NULL;
     ast_expression* expr = NULL;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -104,7 +105,7 @@ ast_while_definition* parse_while_definition(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -118,14 +119,14 @@ ast_while_definition* parse_while_definition(void) {
  */
 ast_while_clause* parse_while_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_while_clause* node = NULL;
     ast_while_definition* nterm;
     ast_function_body* body;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -172,7 +173,7 @@ ast_while_clause* parse_while_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -186,14 +187,14 @@ ast_while_clause* parse_while_clause(void) {
  */
 ast_do_clause* parse_do_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_do_clause* node = NULL;
     ast_while_definition* nterm;
     ast_function_body* body;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -252,7 +253,7 @@ ast_do_clause* parse_do_clause(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -267,7 +268,7 @@ ast_do_clause* parse_do_clause(void) {
  */
 ast_for_clause* parse_for_clause(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_for_clause* node = NULL;
     ast_expression* expr = NULL;
     Token* symbol = NULL;
@@ -276,7 +277,7 @@ ast_for_clause* parse_for_clause(void) {
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -541,7 +542,7 @@ ast_for_clause* parse_for_clause(void) {
     //     }
     // }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
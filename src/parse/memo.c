@@ -0,0 +1,156 @@
+/**
+ * @file memo.c
+ *
+ * @brief This is the packrat memo for the parser. Some rules are tried
+ * again and again at the same token as the alternatives that contain them
+ * fail and reset the queue. For example, a statement that starts with a
+ * compound reference is parsed as an assignment, then as a function
+ * reference. The memo saves the result of a rule at a position in the token
+ * queue, whether it matched or not, so the second try returns the same node
+ * and moves to the same place without parsing anything.
+ *
+ * The memo is a direct mapped cache. A new result replaces whatever was in
+ * its slot, so the memory used is fixed and nothing needs to be cleared
+ * when the tokens that the old entries refer to are finalized. Losing an
+ * entry only means that the rule is parsed again.
+ *
+ * Nothing is saved or looked up while the parser is recovering from an
+ * error, because the queue does not reset in that state.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <stdint.h>
+
+#include "memo.h"
+#include "parse_state.h"
+
+#define MEMO_BITS 10
+#define MEMO_SIZE (0x01 << MEMO_BITS)
+
+typedef struct {
+    void* node;     // the result of the rule, NULL if it did not match
+    TokPost post;   // where the rule was tried
+    TokPost end;    // where the queue was when the rule returned
+    int queue;      // the token queue that the posts belong to
+    int rule;       // the rule plus one, zero if the entry is empty
+} MemoEntry;
+
+static _Thread_local MemoEntry memo_table[MEMO_SIZE];
+static _Thread_local MemoStats memo_stats[MEMO_NUM_RULES];
+static _Thread_local bool memo_enabled = true;
+
+static const char* memo_names[] = {
+    "compound_reference",
+};
+
+/**
+ * @brief Return the entry that the rule at the post is stored in.
+ *
+ * @param rule
+ * @param post
+ * @return MemoEntry*
+ */
+static inline MemoEntry* memo_slot(MemoRule rule, TokPost post) {
+
+    // Fibonacci hashing, so neighboring posts land far apart
+    uint32_t hash = ((uint32_t)post * MEMO_NUM_RULES + (uint32_t)rule) * 2654435761u;
+    return &memo_table[hash >> (32 - MEMO_BITS)];
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Turn the memo on or off. It is on by default.
+ *
+ * @param state
+ */
+void set_memo_state(bool state) {
+
+    memo_enabled = state;
+}
+
+/**
+ * @brief Return true if the memo is being used.
+ *
+ * @return bool
+ */
+bool get_memo_state(void) {
+
+    return memo_enabled;
+}
+
+/**
+ * @brief Look for the result of a rule at the post. If it is found, then
+ * the node is returned through the pointer, the queue is moved to where
+ * the rule left it and the return value is true.
+ *
+ * @param rule
+ * @param post
+ * @param node
+ * @return bool
+ */
+bool find_memo(MemoRule rule, TokPost post, void** node) {
+
+    if(!memo_enabled || get_recovery_state())
+        return false;
+
+    MemoEntry* ent = memo_slot(rule, post);
+    if(ent->rule == (int)rule + 1 && ent->post == post && ent->queue == token_queue_id()) {
+        memo_stats[rule].hits++;
+        *node = ent->node;
+        reset_token_queue(ent->end);
+        return true;
+    }
+
+    memo_stats[rule].misses++;
+    return false;
+}
+
+/**
+ * @brief Save the result of a rule that was tried at the post. The end
+ * position is where the queue is now. A rule that reported an error is
+ * not saved.
+ *
+ * @param rule
+ * @param post
+ * @param node
+ */
+void save_memo(MemoRule rule, TokPost post, void* node) {
+
+    if(!memo_enabled || get_recovery_state())
+        return;
+
+    MemoEntry* ent = memo_slot(rule, post);
+    ent->node      = node;
+    ent->post      = post;
+    ent->end       = post_token_queue();
+    ent->queue     = token_queue_id();
+    ent->rule      = (int)rule + 1;
+}
+
+/**
+ * @brief Return the number of times the memo was used for a rule.
+ *
+ * @param rule
+ * @return const MemoStats*
+ */
+const MemoStats* get_memo_stats(MemoRule rule) {
+
+    return &memo_stats[rule];
+}
+
+/**
+ * @brief Return the name of the rule for reports.
+ *
+ * @param rule
+ * @return const char*
+ */
+const char* memo_rule_name(MemoRule rule) {
+
+    return (rule < MEMO_NUM_RULES) ? memo_names[rule] : "unknown";
+}
@@ -0,0 +1,41 @@
+/**
+ * @file memo.h
+ *
+ * @brief Public interface to the packrat memo for parser rules that are
+ * tried more than once at the same place in the token stream.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _MEMO_H_
+#define _MEMO_H_
+
+#include <stdbool.h>
+
+#include "scanner.h"
+
+/**
+ * @brief The rules that are memoized. A rule can only be added here if the
+ * result depends on nothing but the tokens that it reads, and it is only
+ * worth adding if it is actually tried again at the same token.
+ */
+typedef enum {
+    MEMO_COMPOUND_REFERENCE,
+    MEMO_NUM_RULES,
+} MemoRule;
+
+typedef struct {
+    unsigned long hits;
+    unsigned long misses;
+} MemoStats;
+
+void set_memo_state(bool state);
+bool get_memo_state(void);
+bool find_memo(MemoRule rule, TokPost post, void** node);
+void save_memo(MemoRule rule, TokPost post, void* node);
+const MemoStats* get_memo_stats(MemoRule rule);
+const char* memo_rule_name(MemoRule rule);
+
+#endif /* _MEMO_H_ */
@@ -0,0 +1,376 @@
+import sys
+import re
+
+# Make a token bitmap for every rule in the grammar that is in the main
+# README.md. A bit is set for every token that the rule can start with. If
+# the rule can match nothing, then the tokens that can follow it are set as
+# well, because the rule can return without an error when it sees them. The
+# parser uses these to reject a rule with a single bit test.
+#
+# usage: mk_first.py README.md tokens.h source.c ...
+#
+# The build fails if the grammar refers to a rule or a token that does not
+# exist, or if a parse function that is guarded by CAN_START() calls a rule
+# that can start with a token that is not in the bitmap of the guard.
+
+def fail(msg):
+    sys.stderr.write("mk_first.py: %s\n"%(msg))
+    sys.exit(1)
+
+# Terminals that are not keywords. Keywords are in quotes and are the
+# TOK_ name of the word in upper case.
+operators = {
+    "(": "TOK_OPAREN", ")": "TOK_CPAREN",
+    "{": "TOK_OCBRACE", "}": "TOK_CCBRACE",
+    "[": "TOK_OSBRACE", "]": "TOK_CSBRACE",
+    "<": "TOK_OPBRACE", ">": "TOK_CPBRACE",
+    ",": "TOK_COMMA", ".": "TOK_DOT", ":": "TOK_COLON",
+    "=": "TOK_ASSIGN", "==": "TOK_EQU", "!=": "TOK_NEQU",
+    "<=": "TOK_LORE", ">=": "TOK_GORE",
+    "+": "TOK_ADD", "-": "TOK_SUB", "*": "TOK_MUL",
+    "/": "TOK_DIV", "%": "TOK_MOD", "^": "TOK_CARAT", "!": "TOK_NOT",
+    "+=": "TOK_ADD_ASSIGN", "-=": "TOK_SUB_ASSIGN", "*=": "TOK_MUL_ASSIGN",
+    "/=": "TOK_DIV_ASSIGN", "%=": "TOK_MOD_ASSIGN",
+}
+
+constructed = {
+    "SYMBOL": ["TOK_SYMBOL"],
+    "LITERAL_FLOAT": ["TOK_LITERAL_FLOAT"],
+    "LITERAL_SIGNED": ["TOK_LITERAL_SIGNED"],
+    "LITERAL_UNSIGNED": ["TOK_LITERAL_UNSIGNED"],
+    "LITERAL_DSTRG": ["TOK_LITERAL_DSTR"],
+    "LITERAL_SSTRG": ["TOK_LITERAL_SSTR"],
+    "LITERAL_BOOL": ["TOK_TRUE", "TOK_FALSE", "TOK_ON", "TOK_OFF"],
+    "RAW_TEXT": ["TOK_RAW_TEXT"],
+}
+
+# The grammar is the first ``` block after the "# Grammar" heading. A rule
+# is a name at the start of a line followed by indented lines that start
+# with '=' or '/'.
+def read_grammar(fname):
+    with open(fname, "r") as fh:
+        lines = fh.read().split("\n")
+
+    try:
+        start = lines.index("# Grammar")
+        start = lines.index("```", start) + 1
+        end = lines.index("```", start)
+    except ValueError:
+        fail("cannot find the grammar in %s"%(fname))
+
+    rules = {}
+    order = []
+    name = None
+    for line in lines[start:end]:
+        if len(line.strip()) == 0 or line.startswith("#"):
+            name = None
+        elif re.match(r"^[a-z_]+\s*$", line):
+            name = line.strip()
+            if name in rules:
+                fail("rule %s is defined more than once"%(name))
+            rules[name] = []
+            order.append(name)
+        elif name is not None and re.match(r"^\s+[=/]?", line):
+            rules[name] += re.findall(r"'[^']+'|[A-Za-z_]+|[()?*+/=]", line)
+        else:
+            fail("cannot read the grammar line: %s"%(line))
+
+    return (rules, order)
+
+# A production is parsed into nested lists.
+#   ("alt", [seq, ...])
+#   ("seq", [item, ...])
+#   ("opt" / "star" / "plus", item)
+#   ("rule", name) / ("tok", [TOK_NAME, ...])
+class Parser:
+    def __init__(self, name, toks, tokens):
+        self.name = name
+        self.toks = toks
+        self.pos = 0
+        self.tokens = tokens
+
+    def peek(self):
+        return self.toks[self.pos] if self.pos < len(self.toks) else None
+
+    def take(self):
+        self.pos += 1
+        return self.toks[self.pos - 1]
+
+    def production(self):
+        if self.take() != "=":
+            fail("rule %s does not start with '='"%(self.name))
+        node = self.alternatives()
+        if self.peek() is not None:
+            fail("unexpected '%s' in rule %s"%(self.peek(), self.name))
+        return node
+
+    def alternatives(self):
+        alts = [self.sequence()]
+        while self.peek() == "/":
+            self.take()
+            alts.append(self.sequence())
+        return ("alt", alts)
+
+    def sequence(self):
+        items = []
+        while self.peek() not in (None, "/", ")"):
+            items.append(self.item())
+        if len(items) == 0:
+            fail("empty alternative in rule %s"%(self.name))
+        return ("seq", items)
+
+    def item(self):
+        tok = self.take()
+        if tok == "(":
+            node = self.alternatives()
+            if self.take() != ")":
+                fail("missing ')' in rule %s"%(self.name))
+        elif tok.startswith("'"):
+            node = ("tok", [self.terminal(tok[1:-1])])
+        elif tok.isupper():
+            if tok not in constructed:
+                fail("unknown terminal %s in rule %s"%(tok, self.name))
+            node = ("tok", constructed[tok])
+        elif re.match(r"^[a-z_]+$", tok):
+            node = ("rule", tok)
+        else:
+            fail("unexpected '%s' in rule %s"%(tok, self.name))
+
+        post = {"?": "opt", "*": "star", "+": "plus"}
+        if self.peek() in post:
+            node = (post[self.take()], node)
+        return node
+
+    def terminal(self, text):
+        if text in operators:
+            name = operators[text]
+        elif re.match(r"^[a-z]+$", text):
+            name = "TOK_%s"%(text.upper())
+        else:
+            fail("unknown terminal '%s' in rule %s"%(text, self.name))
+        if name not in self.tokens:
+            fail("'%s' in rule %s is not a token"%(text, self.name))
+        return name
+
+# The token names in the order that they appear in the TokenType enum.
+def read_tokens(fname):
+    with open(fname, "r") as fh:
+        text = fh.read()
+
+    m = re.search(r"typedef enum \{(.*?)\} TokenType;", text, re.S)
+    if m is None:
+        fail("cannot find the TokenType enum in %s"%(fname))
+    return re.findall(r"^\s*(TOK_[A-Z_]+),", m.group(1), re.M)
+
+def nullable(node, null):
+    kind, val = node
+    if kind == "alt":
+        return any(nullable(s, null) for s in val)
+    if kind == "seq":
+        return all(nullable(i, null) for i in val)
+    if kind in ("opt", "star"):
+        return True
+    if kind == "plus":
+        return nullable(val, null)
+    if kind == "rule":
+        return null[val]
+    return False
+
+def first(node, null, firsts):
+    kind, val = node
+    if kind == "alt":
+        return set().union(*[first(s, null, firsts) for s in val])
+    if kind == "seq":
+        out = set()
+        for i in val:
+            out |= first(i, null, firsts)
+            if not nullable(i, null):
+                break
+        return out
+    if kind in ("opt", "star", "plus"):
+        return first(val, null, firsts)
+    if kind == "rule":
+        return firsts[val]
+    return set(val)
+
+# Add what can follow each rule that is referenced in the node, given what
+# can follow the node itself.
+def follow(node, after, null, firsts, follows):
+    kind, val = node
+    if kind == "alt":
+        for s in val:
+            follow(s, after, null, firsts, follows)
+    elif kind == "seq":
+        for idx in range(len(val)):
+            # the rest of the sequence, and what follows the sequence if
+            # all of the rest can be empty
+            rest = set()
+            for nxt in val[idx + 1:]:
+                rest |= first(nxt, null, firsts)
+                if not nullable(nxt, null):
+                    break
+            else:
+                rest |= after
+            follow(val[idx], rest, null, firsts, follows)
+    elif kind in ("star", "plus"):
+        follow(val, after | first(val, null, firsts), null, firsts, follows)
+    elif kind == "opt":
+        follow(val, after, null, firsts, follows)
+    elif kind == "rule":
+        follows[val] |= after
+
+def calculate(rules, order):
+    null = dict((n, False) for n in order)
+    changed = True
+    while changed:
+        changed = False
+        for n in order:
+            if not null[n] and nullable(rules[n], null):
+                null[n] = changed = True
+
+    firsts = dict((n, set()) for n in order)
+    changed = True
+    while changed:
+        changed = False
+        for n in order:
+            f = first(rules[n], null, firsts)
+            if f != firsts[n]:
+                firsts[n] = f
+                changed = True
+
+    follows = dict((n, set()) for n in order)
+    follows[order[0]].add("TOK_END_OF_FILE")
+    changed = True
+    while changed:
+        before = dict((n, set(s)) for (n, s) in follows.items())
+        for n in order:
+            follow(rules[n], follows[n], null, firsts, follows)
+        changed = before != follows
+
+    return (null, firsts, follows)
+
+def references(node, out):
+    kind, val = node
+    if kind in ("alt", "seq"):
+        for i in val:
+            references(i, out)
+    elif kind in ("opt", "star", "plus"):
+        references(val, out)
+    elif kind == "rule":
+        out.add(val)
+    return out
+
+# Find the rules that are guarded with CAN_START() and make sure that every
+# rule their parse function calls can only start with a token that is in
+# the bitmap of the guarded rule. If one could not, then the bitmap would
+# reject something that the function would have accepted.
+def check_sources(fnames, rules, predict, firsts):
+    for fname in fnames:
+        with open(fname, "r") as fh:
+            text = fh.read()
+
+        funcs = re.finditer(r"^\w+\* parse_(\w+)\(void\) \{\n(.*?)^\}", text, re.S | re.M)
+        for m in funcs:
+            name, body = m.group(1), m.group(2)
+            guards = re.findall(r"CAN_START\((\w+)\)", body)
+            if len(guards) == 0:
+                continue
+            for g in guards:
+                if g != name:
+                    fail("%s: parse_%s() is guarded with the rule %s"%(fname, name, g))
+            if name not in rules:
+                fail("%s: parse_%s() is guarded but %s is not in the grammar"%(
+                        fname, name, name))
+
+            for call in sorted(set(re.findall(r"\bparse_(\w+)\(\)", body))):
+                if call not in rules:
+                    fail("%s: parse_%s() calls parse_%s() which is not in the grammar"%(
+                            fname, name, call))
+                missing = firsts[call] - predict[name]
+                if len(missing) > 0:
+                    fail("%s: parse_%s() calls parse_%s() which can start with %s"%(
+                            fname, name, call, " ".join(sorted(missing))))
+
+(rules, order) = read_grammar(sys.argv[1])
+tokens = read_tokens(sys.argv[2])
+tokset = set(tokens)
+for n in order:
+    rules[n] = Parser(n, rules[n], tokset).production()
+
+for n in order:
+    for r in sorted(references(rules[n], set())):
+        if r not in rules:
+            fail("rule %s refers to %s, which is not defined"%(n, r))
+
+(null, firsts, follows) = calculate(rules, order)
+
+predict = {}
+for n in order:
+    predict[n] = firsts[n] | follows[n] if null[n] else set(firsts[n])
+
+check_sources(sys.argv[3:], rules, predict, firsts)
+
+words = (len(tokens) + 31) // 32
+
+def bitmap(toks):
+    w = [0] * words
+    for t in toks:
+        idx = tokens.index(t)
+        w[idx >> 5] |= 1 << (idx & 31)
+    return ", ".join("0x%08X"%(x) for x in w)
+
+hout = []
+hout.append("/* This file is generated with a script. Do not edit. */")
+hout.append("#ifndef _FIRST_SETS_H_")
+hout.append("#define _FIRST_SETS_H_")
+hout.append("#include <stdbool.h>")
+hout.append("#include <stdint.h>")
+hout.append("#include \"tokens.h\"")
+hout.append("")
+hout.append("typedef enum {")
+hout += ["    FIRST_%s,"%(n) for n in order]
+hout.append("    FIRST_NUM_RULES,")
+hout.append("} FirstRule;")
+hout.append("")
+hout.append("#define FIRST_WORDS %d"%(words))
+hout.append("")
+hout.append("extern const uint32_t first_sets[FIRST_NUM_RULES][FIRST_WORDS];")
+hout.append("")
+hout.append("/*")
+hout.append(" * Return true if the rule can start with the token, or can match nothing")
+hout.append(" * and return when it sees the token.")
+hout.append(" */")
+hout.append("static inline bool in_first_set(FirstRule rule, TokenType type) {")
+hout.append("    return (first_sets[rule][type >> 5] >> (type & 31)) & 0x01;")
+hout.append("}")
+hout.append("")
+hout.append("#define CAN_START(rule) (in_first_set(FIRST_##rule, TTYPE))")
+hout.append("")
+hout.append("#endif /* _FIRST_SETS_H_ */")
+
+cout = []
+cout.append("/* This file is generated with a script. Do not edit. */")
+cout.append("#include \"first_sets.h\"")
+cout.append("")
+cout.append("_Static_assert(%s == %d, \"the token list changed\");"%(tokens[-1], len(tokens) - 1))
+cout.append("")
+cout.append("const uint32_t first_sets[FIRST_NUM_RULES][FIRST_WORDS] = {")
+for n in order:
+    toks = sorted(predict[n], key = tokens.index)
+    cout.append("    // %s%s"%(n, " (can be empty)" if null[n] else ""))
+    line = "    //"
+    for t in toks:
+        if len(line) + len(t) > 78:
+            cout.append(line)
+            line = "    //"
+        line += " " + t
+    cout.append(line)
+    cout.append("    [FIRST_%s] = { %s },"%(n, bitmap(toks)))
+cout.append("};")
+cout.append("")
+
+with open("first_sets.h", "w") as fh:
+    fh.write("\n".join(hout) + "\n")
+
+with open("first_sets.c", "w") as fh:
+    fh.write("\n".join(cout))
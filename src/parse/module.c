@@ -8,9 +8,10 @@
  * @date 02-26-2024
  * @copyright Copyright (c) 2024
  */
-#include "link_list.h"
+#include "first_sets.h"
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -24,18 +25,21 @@
  */
 ast_module* parse_module(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_module* node = NULL;
     ast_module_item* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
 
     while(true) {
         if(NULL != (nterm = parse_module_item())) {
-            append_link_list(list, nterm);
+            add_ast_buf(&buf, nterm);
+            // nothing above this can back up into a finished module item
+            finalize_token_queue();
         }
         else if(TOK_END_OF_FILE == TTYPE) {
             node = CREATE_AST_NODE(AST_module, ast_module);
-            node->list = list;
+            node->list = finish_ast_buf(&buf);
             finalize_token_queue();
             close_file();
             TRACE("end of file");
@@ -48,7 +52,7 @@ ast_module* parse_module(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -64,10 +68,14 @@ ast_module* parse_module(void) {
  */
 ast_module_item* parse_module_item(void) {
 
-    ENTER;
+    RULE_ENTER;
+    // nothing here can start with this token
+    if(!CAN_START(module_item))
+        RULE_RETV(NULL);
+
     ast_module_item* node = NULL;
     ast_node* nterm;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if((NULL != (nterm = (ast_node*)parse_namespace_item())) ||
             (NULL != (nterm = (ast_node*)parse_import_statement())) ||
@@ -82,7 +90,7 @@ ast_module_item* parse_module_item(void) {
         reset_token_queue(post);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -102,10 +110,14 @@ ast_module_item* parse_module_item(void) {
  */
 ast_namespace_item* parse_namespace_item(void) {
 
-    ENTER;
+    RULE_ENTER;
+    // nothing here can start with this token
+    if(!CAN_START(namespace_item))
+        RULE_RETV(NULL);
+
     ast_namespace_item* node = NULL;
     ast_node* nterm;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if((NULL != (nterm = (ast_node*)parse_scope_operator())) ||
             (NULL != (nterm = (ast_node*)parse_namespace_definition())) ||
@@ -124,7 +136,7 @@ ast_namespace_item* parse_namespace_item(void) {
         reset_token_queue(post);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -138,7 +150,7 @@ ast_namespace_item* parse_namespace_item(void) {
  */
 ast_namespace_definition* parse_namespace_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_namespace_definition* node = NULL;
 
     if(TOK_NAMESPACE == TTYPE) {
@@ -150,19 +162,25 @@ ast_namespace_definition* parse_namespace_definition(void) {
         if(TOK_SYMBOL == TTYPE) {
             node->name = get_token();
             TRACE_TERM(node->name);
-            push_name(node->name->str);
+            push_name(node->name->sym);
             advance_token();
 
             if(TOK_OCBRACE == TTYPE) {
                 advance_token();
 
-                node->list = create_link_list();
+                AstBuf buf;
+                init_ast_buf(&buf);
                 ast_node* nterm;
                 while(true) {
-                    if(NULL != (nterm = (ast_node*)parse_namespace_item()))
-                        append_link_list(node->list, nterm);
+                    if(NULL != (nterm = (ast_node*)parse_namespace_item())) {
+                        add_ast_buf(&buf, nterm);
+                        // past the '{' this rule either matches or is an
+                        // error, so the callers will not back up into it
+                        finalize_token_queue();
+                    }
                     else if(TOK_CCBRACE == TTYPE) {
                         TRACE("scope before return: %s", raw_string(get_compound_name()));
+                        node->list = finish_ast_buf(&buf);
                         advance_token();
                         pop_scope();
                         pop_name();
@@ -186,7 +204,7 @@ ast_namespace_definition* parse_namespace_definition(void) {
         }
     }
     // else not a namespace definition
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -204,10 +222,14 @@ ast_namespace_definition* parse_namespace_definition(void) {
  */
 ast_class_item* parse_class_item(void) {
 
-    ENTER;
+    RULE_ENTER;
+    // nothing here can start with this token
+    if(!CAN_START(class_item))
+        RULE_RETV(NULL);
+
     ast_class_item* node = NULL;
     ast_node* nterm;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if((NULL != (nterm = (ast_node*)parse_scope_operator())) ||
             (NULL != (nterm = (ast_node*)parse_destroy_declaration())) ||
@@ -215,7 +237,7 @@ ast_class_item* parse_class_item(void) {
             (NULL != (nterm = (ast_node*)parse_function_declaration())) ||
             (NULL != (nterm = (ast_node*)parse_class_var_declaration()))) {
 
-        node = CREATE_AST_NODE(AST_module_item, ast_class_item);
+        node = CREATE_AST_NODE(AST_class_item, ast_class_item);
         node->nterm = nterm;
         node->scope = get_scope();
         TRACE_TERM(get_token());
@@ -226,7 +248,7 @@ ast_class_item* parse_class_item(void) {
         reset_token_queue(post);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -241,7 +263,7 @@ ast_class_item* parse_class_item(void) {
  */
 ast_class_definition* parse_class_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_class_definition* node = NULL;
 
     if(TOK_CLASS == TTYPE) {
@@ -252,7 +274,7 @@ ast_class_definition* parse_class_definition(void) {
 
         if(TOK_SYMBOL == TTYPE) {
             node->name = get_token();
-            push_name(node->name->str);
+            push_name(node->name->sym);
             advance_token();
 
             // optional type name
@@ -270,7 +292,7 @@ ast_class_definition* parse_class_definition(void) {
                 }
                 else {
                     EXPECTED("a ')'");
-                    RETV(NULL);
+                    RULE_RETV(NULL);
                 }
             }
             // else no parens
@@ -278,13 +300,17 @@ ast_class_definition* parse_class_definition(void) {
             if(TOK_OCBRACE == TTYPE) {
                 advance_token();
 
-                node->list = create_link_list();
+                AstBuf buf;
+                init_ast_buf(&buf);
                 ast_node* nterm;
                 while(true) {
-                    if(NULL != (nterm = (ast_node*)parse_class_item()))
-                        append_link_list(node->list, nterm);
+                    if(NULL != (nterm = (ast_node*)parse_class_item())) {
+                        add_ast_buf(&buf, nterm);
+                        finalize_token_queue();
+                    }
                     else if(TOK_CCBRACE == TTYPE) {
                         TRACE("scope before return: %s", raw_string(get_compound_name()));
+                        node->list = finish_ast_buf(&buf);
                         pop_scope();
                         pop_name();
                         advance_token();
@@ -310,7 +336,7 @@ ast_class_definition* parse_class_definition(void) {
     }
     // else not a class definition
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 
@@ -325,13 +351,13 @@ ast_class_definition* parse_class_definition(void) {
  */
 ast_class_var_declaration* parse_class_var_declaration(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_class_var_declaration* node = NULL;
     ast_var_decl* var;
 
     bool finished = false;
     int state = 0;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -375,6 +401,6 @@ ast_class_var_declaration* parse_class_var_declaration(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
@@ -9,7 +9,10 @@
  * @copyright Copyright (c) 2024
  */
 #include "trace.h"
+#include "fileio.h"
+#include "import_jobs.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 #include "paths.h"
 #include "symbols.h"
@@ -28,8 +31,6 @@ static const char* dummy_path[] = {
 };
 
 
-extern ParserState* parser_state;
-
 /**
  * @brief Initialize the parser and open the first file.
  *
@@ -50,6 +51,19 @@ void init_parser(const char* fname) {
     RET;
 }
 
+/**
+ * @brief Initialize the parser of a thread that parses imported modules for
+ * the thread that called init_parser(). It opens its own files.
+ *
+ */
+void init_parser_thread(void) {
+
+    ENTER;
+    init_paths(dummy_path);
+    create_parser_state();
+    RET;
+}
+
 /**
  * @brief Public interface to the parser. This is also called by the import
  * functionality.
@@ -59,13 +73,14 @@ void init_parser(const char* fname) {
  */
 ast_module* parse(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_module* node = NULL;
 
+    submit_import_scan(get_fname());
     if(NULL == (node = parse_module())) {
         show_warning("module is empty");
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
@@ -89,7 +89,6 @@ ast_assignment* parse_assignment(void);
 ast_cast_statement* parse_cast_statement(void);
 
 // expression.c
-ast_operator* parse_operator(void);
 ast_expression* parse_expression(void);
 ast_expr_primary* parse_expr_primary(void);
 
@@ -110,10 +109,20 @@ ast_except_clause* parse_except_clause(void);
 ast_final_clause* parse_final_clause(void);
 
 // import.c
+typedef struct {
+    unsigned long parsed; // modules that were read and parsed
+    unsigned long loaded; // modules that were loaded from interface files
+    unsigned long cached; // imports of a module that was already parsed
+    unsigned long jobs;   // modules that were parsed by the import threads
+} ImportStats;
+
 ast_import_statement* parse_import_statement(void);
+void prefetch_imports(const char* path);
+const ImportStats* get_import_stats(void);
 
 // parse.c
 void init_parser(const char* fname);
+void init_parser_thread(void);
 ast_module* parse(void);
 
 #define PARSER_SYNTAX_ERROR 1000
@@ -14,7 +14,7 @@
 #include "memory.h"
 #include "parse_state.h"
 
-ParserState* parser_state = NULL;
+_Thread_local ParserState* parser_state = NULL;
 
 /**
  * @brief Return the printable name for a scope enum.
@@ -56,7 +56,7 @@ void set_scope(ScopeType scope) {
 void push_scope(ScopeType scope) {
 
     ENTER;
-    ScopeType* node = _ALLOC_T(ScopeType);
+    ScopeType* node = _ARENA_ALLOC_T(ScopeType);
     *node = scope;
 
     TRACE("scope: %s", scope_name(scope));
@@ -103,52 +103,51 @@ ScopeType get_scope(void) {
 ParserState* create_parser_state(void) {
 
     ENTER;
-    parser_state = _ALLOC_T(ParserState);
+    parser_state = _ARENA_ALLOC_T(ParserState);
 
     parser_state->scope_stack = create_link_list();
     push_scope(SCOPE_PRIV);
 
-    parser_state->name_stack = create_link_list();
-    push_name(create_string("root"));
+    parser_state->name_cap   = 0x01 << 3;
+    parser_state->name_len   = 0;
+    parser_state->name_stack = _ALLOC_ARRAY(SymId, parser_state->name_cap);
+    push_name(intern_str("root"));
 
     parser_state->is_import = false;
 
     RETV(parser_state);
 }
 
-void push_name(String* name) {
+void push_name(SymId name) {
 
     ENTER;
-    TRACE("name: %s", name->buffer);
-    push_link_list(parser_state->name_stack, name);
+    TRACE("name: %s", interned_str(name));
+    if(parser_state->name_len + 1 >= parser_state->name_cap) {
+        parser_state->name_cap <<= 1;
+        parser_state->name_stack = _REALLOC_ARRAY(parser_state->name_stack, SymId, parser_state->name_cap);
+    }
+    parser_state->name_stack[parser_state->name_len++] = name;
     RET;
 }
 
-String* pop_name(void) {
+SymId pop_name(void) {
 
-    ENTER;
-    RETV(pop_link_list(parser_state->name_stack));
+    assert(parser_state->name_len > 0);
+    return parser_state->name_stack[--parser_state->name_len];
 }
 
-String* get_name(void) {
+SymId get_name(void) {
 
-    ENTER;
-    RETV(peek_link_list(parser_state->name_stack));
+    assert(parser_state->name_len > 0);
+    return parser_state->name_stack[parser_state->name_len - 1];
 }
 
 String* get_compound_name(void) {
 
     String* str = create_string(NULL);
-    String* sptr;
-    StrList* lptr = create_string_list();
-    void* mark = NULL;
-
-    while(NULL != (sptr = iter_link_list(parser_state->name_stack, &mark)))
-        push_string_list(lptr, sptr);
 
-    mark = NULL;
-    while(NULL != (sptr = iter_link_list(lptr, &mark))) {
-        add_string_Str(str, sptr);
+    for(int i = 0; i < parser_state->name_len; i++) {
+        add_string_str(str, interned_str(parser_state->name_stack[i]));
         add_string_char(str, '.');
     }
 
@@ -13,6 +13,7 @@
 
 #include "sstrings.h"
 #include "link_list.h"
+#include "intern.h"
 
 /**
  * @brief The scope is a state that is tracked as items are parsed.
@@ -29,7 +30,9 @@ typedef enum {
  */
 typedef struct {
     LinkList* scope_stack;
-    LinkList* name_stack;
+    SymId* name_stack;
+    int name_len;
+    int name_cap;
     bool is_import;
     bool in_recovery;
 } ParserState;
@@ -42,9 +45,9 @@ ScopeType pop_scope(void);
 ScopeType get_scope(void);
 const char* scope_name(ScopeType type);
 
-void push_name(String* name);
-String* pop_name(void);
-String* get_name(void);
+void push_name(SymId name);
+SymId pop_name(void);
+SymId get_name(void);
 String* get_compound_name(void);
 
 void set_import_state(bool val);
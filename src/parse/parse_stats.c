@@ -0,0 +1,362 @@
+/**
+ * @file parse_stats.c
+ *
+ * @brief The parser statistics. The rules that are active are kept on a
+ * stack of frames. When a rule returns, the time and the queue resets that
+ * were counted while it was active are given to the rule that called it as
+ * well, so that each rule can report what it did by itself as well as what
+ * it did in total. A rule that calls itself only counts its total once.
+ *
+ * Every thread counts its own rules. An import thread gives the counts of
+ * each job to the thread that compiles, which adds them to its own when it
+ * uses the tree of the job, and the time that it waits for a job is not
+ * counted in the rules that are active.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lazy.h"
+#include "memo.h"
+#include "memory.h"
+#include "parse.h"
+#include "parse_stats.h"
+#include "scanner.h"
+
+typedef struct {
+    RuleStats* rule;
+    uint64_t start;
+    uint64_t child_ns;
+    unsigned long resets;  // the queue counts when the rule was entered
+    unsigned long rewound;
+    unsigned long child_resets;
+    unsigned long child_rewound;
+} RuleFrame;
+
+_Thread_local bool parse_stats_state = false;
+
+static _Thread_local RuleFrame* frames = NULL;
+static _Thread_local int num_frames    = 0;
+static _Thread_local int cap_frames    = 0;
+static _Thread_local RuleStats* rules  = NULL;
+static _Thread_local int num_rules     = 0;
+static _Thread_local uint64_t paused   = 0;
+static _Thread_local uint64_t wait_ns  = 0;
+
+static inline uint64_t now_ns(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Sort the rules with the most time spent in them first.
+ *
+ * @param a
+ * @param b
+ * @return int
+ */
+static int by_self_time(const void* a, const void* b) {
+
+    const RuleStats* ra = *(RuleStats* const*)a;
+    const RuleStats* rb = *(RuleStats* const*)b;
+
+    return (ra->self_ns < rb->self_ns) ? 1 : (ra->self_ns > rb->self_ns) ? -1 : 0;
+}
+
+/**
+ * @brief Add the counts of one rule to another.
+ *
+ * @param to
+ * @param from
+ */
+static void add_counts(RuleStats* to, const RuleStats* from) {
+
+    to->calls += from->calls;
+    to->matched += from->matched;
+    to->resets += from->resets;
+    to->rewound += from->rewound;
+    to->total_ns += from->total_ns;
+    to->self_ns += from->self_ns;
+}
+
+/**
+ * @brief Find a rule in the list by its name and take it out of the list.
+ *
+ * @param name
+ * @return RuleStats* NULL if it is not there
+ */
+static RuleStats* unlink_rule(const char* name) {
+
+    for(RuleStats** link = &rules; *link != NULL; link = &(*link)->next) {
+        RuleStats* rule = *link;
+        if(!strcmp(rule->name, name)) {
+            *link = rule->next;
+            num_rules--;
+            return rule;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Put a rule at the front of the list.
+ *
+ * @param rule
+ */
+static void link_rule(RuleStats* rule) {
+
+    rule->listed = true;
+    rule->next   = rules;
+    rules        = rule;
+    num_rules++;
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Turn the statistics on or off. They are off by default.
+ *
+ * @param state
+ */
+void set_parse_stats(bool state) {
+
+    parse_stats_state = state;
+}
+
+/**
+ * @brief Start counting a call to a rule. The return value is the frame
+ * that is passed to exit_rule_stats() when the rule returns.
+ *
+ * @param rule
+ * @return int
+ */
+int enter_rule_stats(RuleStats* rule) {
+
+    if(!rule->listed) {
+        // an import job may have given the rule counts before it was called here
+        RuleStats* counts = unlink_rule(rule->name);
+        if(counts != NULL) {
+            add_counts(rule, counts);
+            _FREE(counts);
+        }
+        link_rule(rule);
+    }
+
+    if(num_frames + 1 > cap_frames) {
+        cap_frames = (cap_frames == 0) ? 0x40 : cap_frames << 1;
+        frames     = _REALLOC_ARRAY(frames, RuleFrame, cap_frames);
+    }
+
+    const TokQueueStats* qs = get_token_queue_stats();
+    RuleFrame* frame        = &frames[num_frames];
+    frame->rule             = rule;
+    frame->child_ns         = 0;
+    frame->resets           = qs->resets;
+    frame->rewound          = qs->rewound;
+    frame->child_resets     = 0;
+    frame->child_rewound    = 0;
+
+    rule->calls++;
+    rule->active++;
+
+    // take the time last so the setup is not counted
+    frame->start = now_ns();
+
+    return num_frames++;
+}
+
+/**
+ * @brief Finish counting a call to a rule.
+ *
+ * @param frame
+ * @param matched
+ */
+void exit_rule_stats(int frame, bool matched) {
+
+    uint64_t elapsed = now_ns();
+
+    // every rule returns through RULE_RETV() so this is always the top
+    assert(frame == num_frames - 1);
+    num_frames = frame;
+
+    RuleFrame* fp           = &frames[frame];
+    RuleStats* rule         = fp->rule;
+    const TokQueueStats* qs = get_token_queue_stats();
+    unsigned long resets    = qs->resets - fp->resets;
+    unsigned long rewound   = qs->rewound - fp->rewound;
+
+    elapsed -= fp->start;
+    rule->self_ns += elapsed - fp->child_ns;
+    rule->resets += resets - fp->child_resets;
+    rule->rewound += rewound - fp->child_rewound;
+    if(matched)
+        rule->matched++;
+    if(--rule->active == 0)
+        rule->total_ns += elapsed;
+
+    if(frame > 0) {
+        frames[frame - 1].child_ns += elapsed;
+        frames[frame - 1].child_resets += resets;
+        frames[frame - 1].child_rewound += rewound;
+    }
+}
+
+/**
+ * @brief Copy the counts of every rule that this thread called and clear
+ * them. An import thread does this at the end of each job.
+ *
+ * @param count set to the number of rules in the copy
+ * @return RuleStats* the copy, NULL if there are none
+ */
+RuleStats* take_rule_stats(int* count) {
+
+    RuleStats* list = (num_rules > 0) ? _ALLOC_ARRAY(RuleStats, num_rules) : NULL;
+    int n           = 0;
+
+    for(RuleStats* rule = rules; rule != NULL; rule = rule->next) {
+        if(rule->calls == 0)
+            continue;
+        list[n].name = rule->name;
+        add_counts(&list[n++], rule);
+        rule->calls    = 0;
+        rule->matched  = 0;
+        rule->resets   = 0;
+        rule->rewound  = 0;
+        rule->total_ns = 0;
+        rule->self_ns  = 0;
+    }
+
+    *count = n;
+    return list;
+}
+
+/**
+ * @brief Add the counts that were taken from an import thread to the rules
+ * of this thread. A rule that this thread has not called yet gets an entry
+ * of its own, and the rule takes it over when it is called.
+ *
+ * @param list
+ * @param count
+ */
+void add_rule_stats(const RuleStats* list, int count) {
+
+    for(int i = 0; i < count; i++) {
+        RuleStats* rule = NULL;
+        for(RuleStats* crnt = rules; crnt != NULL && rule == NULL; crnt = crnt->next)
+            if(!strcmp(crnt->name, list[i].name))
+                rule = crnt;
+
+        if(rule == NULL) {
+            rule       = _ALLOC_T(RuleStats);
+            rule->name = list[i].name;
+            link_rule(rule);
+        }
+        add_counts(rule, &list[i]);
+    }
+}
+
+/**
+ * @brief Stop the clock of the rules that are active while this thread
+ * waits for an import thread.
+ */
+void pause_rule_stats(void) {
+
+    if(parse_stats_state)
+        paused = now_ns();
+}
+
+/**
+ * @brief Start the clock of the active rules again after a wait. The time
+ * that was waited is left out of all of them.
+ */
+void resume_rule_stats(void) {
+
+    if(!parse_stats_state)
+        return;
+
+    uint64_t waited = now_ns() - paused;
+    for(int i = 0; i < num_frames; i++)
+        frames[i].start += waited;
+    wait_ns += waited;
+}
+
+/**
+ * @brief Print the statistics for every rule that was called, the rules
+ * that took the most time first.
+ */
+void report_parse_stats(void) {
+
+    RuleStats** list    = _ALLOC_ARRAY(RuleStats*, num_rules);
+    int count           = 0;
+    unsigned long calls = 0;
+    uint64_t self_ns    = 0;
+
+    for(RuleStats* rule = rules; rule != NULL; rule = rule->next) {
+        list[count++] = rule;
+        calls += rule->calls;
+        self_ns += rule->self_ns;
+    }
+
+    qsort(list, count, sizeof(RuleStats*), by_self_time);
+
+    printf("\nParser statistics:\n");
+    printf("%-32s %10s %10s %10s %9s %9s %10s %10s\n", "rule", "calls", "matched", "failed", "resets",
+           "rewound", "total ms", "self ms");
+    for(int i = 0; i < count; i++) {
+        RuleStats* rule = list[i];
+        printf("%-32s %10lu %10lu %10lu %9lu %9lu %10.3f %10.3f\n", rule->name, rule->calls, rule->matched,
+               rule->calls - rule->matched, rule->resets, rule->rewound, rule->total_ns / 1e6,
+               rule->self_ns / 1e6);
+    }
+    printf("%-32s %10lu %63.3f\n", "all rules", calls, self_ns / 1e6);
+
+    const TokQueueStats* qs = get_token_queue_stats();
+    printf("\ntokens scanned: %lu, queue resets: %lu, tokens rewound: %lu (%.2f per reset, %.2f per token)\n",
+           qs->scanned, qs->resets, qs->rewound, (qs->resets != 0) ? (double)qs->rewound / qs->resets : 0.0,
+           (qs->scanned != 0) ? (double)qs->rewound / qs->scanned : 0.0);
+
+    for(MemoRule rule = 0; rule < MEMO_NUM_RULES; rule++) {
+        const MemoStats* ms = get_memo_stats(rule);
+        printf("memo %s: %lu hits, %lu misses\n", memo_rule_name(rule), ms->hits, ms->misses);
+    }
+
+    report_import_stats();
+    // these depend on how fast the threads were, so they are only shown here
+    printf("import jobs: %lu of the modules parsed by the import threads, %.3f ms waited for them\n",
+           get_import_stats()->jobs, wait_ns / 1e6);
+    if(get_import_stats()->jobs != 0)
+        printf("the rules include the import threads, so their times add up to more than the compile took.\n"
+               "the token and memo counts are only for the thread that compiles.\n");
+
+    printf("arena: %lu bytes\n", (unsigned long)compile_arena.total);
+
+    _FREE(list);
+}
+
+/**
+ * @brief Print how the imported modules and their function bodies were
+ * loaded. None of these depend on the time that anything took, so the
+ * parser tests use them.
+ */
+void report_import_stats(void) {
+
+    // a module is parsed once whether or not an import thread did it
+    const ImportStats* is = get_import_stats();
+    printf("imports: %lu modules parsed, %lu loaded from interface files, %lu parses saved by the module cache\n",
+           is->parsed + is->jobs, is->loaded, is->cached);
+
+    const LazyStats* ls = get_lazy_stats();
+    printf("lazy function bodies: %lu skipped, %lu parsed later\n", ls->skipped, ls->loaded);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file parse_stats.h
+ *
+ * @brief Public interface to the parser statistics. Every parser rule
+ * counts how many times it was called and matched, how many times it reset
+ * the token queue and how far, and how much time it took. The counting is
+ * always compiled in, but it costs one test of a flag per rule unless it is
+ * turned on. It does not depend on the trace.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _PARSE_STATS_H_
+#define _PARSE_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "trace.h"
+
+typedef struct _rule_stats_ {
+    const char* name;
+    unsigned long calls;
+    unsigned long matched;
+    unsigned long resets;  // resets of the queue made by the rule itself
+    unsigned long rewound; // tokens given back by those resets
+    uint64_t total_ns;     // time in the rule and the rules that it called
+    uint64_t self_ns;      // time in the rule alone
+    int active;            // calls that have not returned, for recursion
+    bool listed;
+    struct _rule_stats_* next;
+} RuleStats;
+
+extern _Thread_local bool parse_stats_state;
+
+int enter_rule_stats(RuleStats* rule);
+void exit_rule_stats(int frame, bool matched);
+void set_parse_stats(bool state);
+RuleStats* take_rule_stats(int* count);
+void add_rule_stats(const RuleStats* list, int count);
+void pause_rule_stats(void);
+void resume_rule_stats(void);
+void report_parse_stats(void);
+void report_import_stats(void);
+
+/*
+ * Use these in place of ENTER and RETV() in a parser rule. A rule is
+ * counted as matched when it returns something other than NULL. The counts
+ * belong to the thread that does the parse, like the rest of its state.
+ */
+#define RULE_ENTER                                                                                        \
+    static _Thread_local RuleStats _rule_stats = {.name = __func__};                                      \
+    int _rule_frame                            = parse_stats_state ? enter_rule_stats(&_rule_stats) : -1; \
+    ENTER
+
+#define RULE_RETV(v)                                   \
+    do {                                               \
+        if(_rule_frame >= 0)                           \
+            exit_rule_stats(_rule_frame, (v) != NULL); \
+        RETV(v);                                       \
+    } while(false)
+
+#endif /* _PARSE_STATS_H_ */
@@ -10,6 +10,7 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -24,10 +25,10 @@
  */
 ast_string_literal* parse_string_literal(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_string_literal* node = NULL;
     ast_formatted_strg* fstr;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if(TOK_LITERAL_SSTR == TTYPE) {
         TRACE("sstr");
@@ -46,7 +47,7 @@ ast_string_literal* parse_string_literal(void) {
     else
         reset_token_queue(post);
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -60,7 +61,7 @@ ast_string_literal* parse_string_literal(void) {
  */
 ast_formatted_strg* parse_formatted_strg(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_formatted_strg* node = NULL;
     ast_expression_list* nterm;
 
@@ -77,6 +78,6 @@ ast_formatted_strg* parse_formatted_strg(void) {
     }
     // else no tokens are consumed
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
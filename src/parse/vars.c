@@ -10,6 +10,7 @@
  */
 #include "trace.h"
 #include "parse.h"
+#include "parse_stats.h"
 #include "scanner.h"
 
 /**
@@ -23,7 +24,7 @@
  */
 ast_var_decl* parse_var_decl(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_var_decl* node = NULL;
     bool is_const = false;
 
@@ -38,7 +39,6 @@ ast_var_decl* parse_var_decl(void) {
         node = CREATE_AST_NODE(AST_var_decl, ast_var_decl);
         node->is_const = is_const;
         node->type = nterm;
-        finalize_token_queue();
 
         if(TOK_SYMBOL == TTYPE) {
             node->name = get_token();
@@ -55,7 +55,7 @@ ast_var_decl* parse_var_decl(void) {
     }
     // else it's not a var_decl
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -69,13 +69,14 @@ ast_var_decl* parse_var_decl(void) {
  */
 ast_var_decl_list* parse_var_decl_list(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_var_decl_list* node = NULL;
     ast_var_decl* nterm;
-    LinkList* list = create_link_list();
+    AstBuf buf;
+    init_ast_buf(&buf);
     int state = 0;
     bool finished = false;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     while(!finished) {
         switch(state) {
@@ -92,7 +93,7 @@ ast_var_decl_list* parse_var_decl_list(void) {
             case 1:
                 // if there is no var decl, then there must be a ')'
                 if(NULL != (nterm = parse_var_decl())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 2;
                 }
                 else if(TOK_CPAREN == TTYPE) {
@@ -122,7 +123,7 @@ ast_var_decl_list* parse_var_decl_list(void) {
             case 3:
                 // must be an var_decl, or an error
                 if(NULL != (nterm = parse_var_decl())) {
-                    append_link_list(list, nterm);
+                    add_ast_buf(&buf, nterm);
                     state = 2;
                 }
                 else {
@@ -134,7 +135,7 @@ ast_var_decl_list* parse_var_decl_list(void) {
             case 100:
                 // var_decl is complete
                 node = CREATE_AST_NODE(AST_var_decl_list, ast_var_decl_list);
-                node->list = list;
+                node->list = finish_ast_buf(&buf);
                 finished = true;
                 break;
 
@@ -155,7 +156,7 @@ ast_var_decl_list* parse_var_decl_list(void) {
         }
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
 
 /**
@@ -169,11 +170,11 @@ ast_var_decl_list* parse_var_decl_list(void) {
  */
 ast_var_definition* parse_var_definition(void) {
 
-    ENTER;
+    RULE_ENTER;
     ast_var_definition* node = NULL;
     ast_var_decl* nterm;
     ast_assignment_item* item;
-    void* post = post_token_queue();
+    TokPost post = post_token_queue();
 
     if(TOK_VAR == TTYPE || TOK_VARIABLE == TTYPE) {
         advance_token();
@@ -206,5 +207,5 @@ ast_var_definition* parse_var_definition(void) {
         reset_token_queue(post);
     }
 
-    RETV(node);
+    RULE_RETV(node);
 }
@@ -0,0 +1,60 @@
+/**
+ * @file bodypass.c
+ *
+ * @brief This pass parses the function bodies that were skipped when their
+ * module was imported with lazy bodies on. A body is parsed when the pass
+ * enters it, so the passes after this one in the same traversal see it
+ * parsed, and its syntax errors are reported before the passes that need
+ * the bodies run. It is only registered when a pass says that it needs the
+ * bodies, so a compile that does not need them only scans them.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include "bodypass.h"
+#include "lazy.h"
+#include "trace.h"
+
+static _Thread_local bool body_pass_registered = false;
+
+/**
+ * @brief Parse the body if it was skipped.
+ *
+ * @param node
+ *
+ */
+static void pre_function_body(ast_node* node) {
+
+    ENTER;
+    load_function_body((ast_function_body*)node);
+    RET;
+}
+
+const PassTable body_pass = {
+    .pre = {
+        [AST_function_body - AST_FIRST] = pre_function_body,
+    },
+};
+
+/**
+ * @brief Make a pass see every function body parsed. The bodies pass is
+ * registered the first time that a pass needs it, if lazy bodies are on.
+ *
+ * @param name the pass that needs the bodies, which must be registered
+ *
+ */
+void require_function_bodies(const char* name) {
+
+    ENTER;
+    if(!get_lazy_state())
+        RET;
+
+    if(!body_pass_registered) {
+        register_pass_table("bodies", &body_pass);
+        body_pass_registered = true;
+    }
+    require_pass(name, "bodies", PASS_AFTER_NODE);
+    RET;
+}
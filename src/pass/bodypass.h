@@ -0,0 +1,21 @@
+/**
+ * @file bodypass.h
+ *
+ * @brief Public interface to the pass that parses the function bodies that
+ * were skipped when a module was imported.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _BODYPASS_H_
+#define _BODYPASS_H_
+#include "ast.h"
+#include "passes.h"
+
+extern const PassTable body_pass;
+
+void require_function_bodies(const char* name);
+
+#endif /* _BODYPASS_H_ */
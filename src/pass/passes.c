@@ -0,0 +1,380 @@
+/**
+ * @file passes.c
+ *
+ * @brief This is the pass manager. Every pass is a pre and a post function
+ * like the ones that traverse_ast() takes, and it is registered with the
+ * passes that it depends on. When the passes are run, they are put in an
+ * order where every pass comes after the ones that it depends on, and then
+ * split into sweeps. A sweep is one traversal of the AST that calls the pre
+ * function of each of its passes in that order when a node is entered, and
+ * the post functions in the opposite order when it is left, so each pass
+ * sees the nodes nested the same way as if it had the traversal to itself.
+ * A pass only starts a new sweep when it depends on the whole tree of a
+ * pass in the sweep before it, so the number of traversals is the longest
+ * chain of those dependencies and not the number of passes.
+ *
+ * A pass can also be a table with a pre and a post function for each node
+ * type. Before a sweep runs, the functions of its passes are put into a list
+ * for each type, so a node only calls the functions that are there for its
+ * type. The table of the types that a traversal can reach is used to leave
+ * out every subtree that does not have a node that one of the passes wants.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "errors.h"
+#include "memory.h"
+#include "passes.h"
+#include "trace.h"
+
+// the dependencies of a pass are kept in bit masks
+#define MAX_PASSES 32
+#define AST_NUM_TYPES (AST_LAST - AST_FIRST)
+
+typedef struct {
+    const char* name;
+    PassFunc pre;
+    PassFunc post;
+    const PassTable* table; // NULL if the functions take every type
+    uint32_t node_deps; // passes that must handle each node first
+    uint32_t tree_deps; // passes that must handle the whole tree first
+    int sweep;          // the traversal that the pass runs in
+    unsigned long calls;
+    uint64_t ns;
+} Pass;
+
+typedef struct {
+    Pass* pass;
+    PassFunc func;
+} Hook;
+
+static _Thread_local Pass passes[MAX_PASSES];
+static _Thread_local int num_passes = 0;
+
+// the passes of the sweep that is running, in order
+static _Thread_local Pass* active[MAX_PASSES];
+static _Thread_local int num_active = 0;
+
+// the functions of the sweep for each type, pre in order and post reversed
+static _Thread_local Hook* pre_hooks  = NULL;
+static _Thread_local Hook* post_hooks = NULL;
+static _Thread_local int pre_start[AST_NUM_TYPES + 1];
+static _Thread_local int post_start[AST_NUM_TYPES + 1];
+
+// the types that the sweep goes into
+static _Thread_local bool visit[AST_NUM_TYPES];
+
+static _Thread_local bool pass_stats_state = false;
+static _Thread_local int num_sweeps        = 0;
+static _Thread_local uint64_t sweep_ns     = 0;
+
+static inline uint64_t now_ns(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Return the index of the pass with the name.
+ *
+ * @param name
+ * @return int
+ */
+static int find_pass(const char* name) {
+
+    for(int i = 0; i < num_passes; i++) {
+        if(strcmp(passes[i].name, name) == 0)
+            return i;
+    }
+
+    fatal_error("pass manager: unknown pass: %s", name);
+    return -1;
+}
+
+/**
+ * @brief Call the hook of a pass and count the time that it took.
+ *
+ * @param pass
+ * @param func
+ * @param node
+ */
+static void timed_call(Pass* pass, PassFunc func, ast_node* node) {
+
+    uint64_t start = now_ns();
+    (*func)(node);
+    pass->ns += now_ns() - start;
+    pass->calls++;
+}
+
+/**
+ * @brief Enter a node for every pass in the sweep.
+ *
+ * @param node
+ */
+static void fused_pre(ast_node* node) {
+
+    int type = ast_node_type(node) - AST_FIRST;
+
+    for(int i = pre_start[type]; i < pre_start[type + 1]; i++) {
+        if(pass_stats_state)
+            timed_call(pre_hooks[i].pass, pre_hooks[i].func, node);
+        else
+            (*pre_hooks[i].func)(node);
+    }
+}
+
+/**
+ * @brief Leave a node for every pass in the sweep, the last one first.
+ *
+ * @param node
+ */
+static void fused_post(ast_node* node) {
+
+    int type = ast_node_type(node) - AST_FIRST;
+
+    for(int i = post_start[type]; i < post_start[type + 1]; i++) {
+        if(pass_stats_state)
+            timed_call(post_hooks[i].pass, post_hooks[i].func, node);
+        else
+            (*post_hooks[i].func)(node);
+    }
+}
+
+/**
+ * @brief Return the pre or post function that the pass has for the type.
+ *
+ * @param pass
+ * @param type
+ * @param post
+ * @return PassFunc
+ */
+static PassFunc pass_func(Pass* pass, int type, bool post) {
+
+    if(pass->table == NULL)
+        return post ? pass->post : pass->pre;
+
+    return post ? pass->table->post[type] : pass->table->pre[type];
+}
+
+/**
+ * @brief Make the lists of functions for each type from the passes of the
+ * sweep, and mark the types that have one of those types under them.
+ *
+ */
+static void build_sweep(void) {
+
+    uint32_t wanted[AST_REACH_WORDS] = {0};
+    int npre                         = 0;
+    int npost                        = 0;
+
+    pre_hooks  = _ALLOC_ARRAY(Hook, AST_NUM_TYPES * num_active);
+    post_hooks = _ALLOC_ARRAY(Hook, AST_NUM_TYPES * num_active);
+
+    for(int type = 0; type < AST_NUM_TYPES; type++) {
+        pre_start[type]  = npre;
+        post_start[type] = npost;
+        for(int i = 0; i < num_active; i++) {
+            PassFunc func = pass_func(active[i], type, false);
+            if(func != NULL)
+                pre_hooks[npre++] = (Hook){active[i], func};
+        }
+        for(int i = num_active - 1; i >= 0; i--) {
+            PassFunc func = pass_func(active[i], type, true);
+            if(func != NULL)
+                post_hooks[npost++] = (Hook){active[i], func};
+        }
+        if(npre > pre_start[type] || npost > post_start[type])
+            wanted[type / 32] |= 1u << (type % 32);
+    }
+    pre_start[AST_NUM_TYPES]  = npre;
+    post_start[AST_NUM_TYPES] = npost;
+
+    for(int type = 0; type < AST_NUM_TYPES; type++) {
+        visit[type] = false;
+        for(int w = 0; w < AST_REACH_WORDS; w++) {
+            if(ast_reach[type][w] & wanted[w])
+                visit[type] = true;
+        }
+    }
+}
+
+/**
+ * @brief Put the passes in an order where each one comes after the ones
+ * that it depends on, and give each one the first sweep that it can run
+ * in. Passes that do not depend on each other stay in the order that they
+ * were registered.
+ *
+ * @param order
+ * @return int the number of sweeps
+ */
+static int schedule_passes(Pass** order) {
+
+    uint32_t done = 0;
+    int sweeps    = 0;
+
+    for(int count = 0; count < num_passes; count++) {
+        int next = -1;
+        for(int i = 0; i < num_passes && next < 0; i++) {
+            uint32_t deps = passes[i].node_deps | passes[i].tree_deps;
+            if(!(done & (1u << i)) && (deps & ~done) == 0)
+                next = i;
+        }
+        if(next < 0)
+            fatal_error("pass manager: the passes depend on each other");
+
+        Pass* pass  = &passes[next];
+        pass->sweep = 0;
+        for(int i = 0; i < num_passes; i++) {
+            if((pass->node_deps & (1u << i)) && passes[i].sweep > pass->sweep)
+                pass->sweep = passes[i].sweep;
+            if((pass->tree_deps & (1u << i)) && passes[i].sweep + 1 > pass->sweep)
+                pass->sweep = passes[i].sweep + 1;
+        }
+
+        if(pass->sweep + 1 > sweeps)
+            sweeps = pass->sweep + 1;
+        order[count] = pass;
+        done |= 1u << next;
+    }
+
+    return sweeps;
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
+
+/**
+ * @brief Add a pass. Either function can be NULL.
+ *
+ * @param name
+ * @param pre
+ * @param post
+ *
+ */
+void register_pass(const char* name, PassFunc pre, PassFunc post) {
+
+    ENTER;
+    if(num_passes >= MAX_PASSES)
+        fatal_error("pass manager: more than %d passes", MAX_PASSES);
+
+    Pass* pass = &passes[num_passes++];
+    memset(pass, 0, sizeof(Pass));
+    pass->name = name;
+    pass->pre  = pre;
+    pass->post = post;
+    RET;
+}
+
+/**
+ * @brief Add a pass that has a pre and a post function for each node type.
+ * The types that have neither are not given to the pass, and the subtrees
+ * that none of the passes want are not traversed. The table is not copied.
+ *
+ * @param name
+ * @param table
+ *
+ */
+void register_pass_table(const char* name, const PassTable* table) {
+
+    ENTER;
+    register_pass(name, NULL, NULL);
+    passes[num_passes - 1].table = table;
+    RET;
+}
+
+/**
+ * @brief Make a pass depend on another one. Both must be registered.
+ *
+ * @param name
+ * @param dep
+ * @param kind
+ *
+ */
+void require_pass(const char* name, const char* dep, PassDep kind) {
+
+    ENTER;
+    Pass* pass   = &passes[find_pass(name)];
+    uint32_t bit = 1u << find_pass(dep);
+
+    if(kind == PASS_AFTER_TREE)
+        pass->tree_deps |= bit;
+    else
+        pass->node_deps |= bit;
+    RET;
+}
+
+/**
+ * @brief Run all of the passes over the AST, each sweep in one traversal.
+ *
+ * @param node
+ *
+ */
+void run_passes(ast_module* node) {
+
+    ENTER;
+    Pass* order[MAX_PASSES];
+    int sweeps = schedule_passes(order);
+
+    for(int sweep = 0; sweep < sweeps; sweep++) {
+        num_active = 0;
+        for(int i = 0; i < num_passes; i++) {
+            if(order[i]->sweep == sweep)
+                active[num_active++] = order[i];
+        }
+
+        uint64_t start = now_ns();
+        // a pass that has the traversal to itself does not need to be fused
+        if(num_active == 1 && active[0]->table == NULL && !pass_stats_state)
+            traverse_ast(node, active[0]->pre, active[0]->post);
+        else {
+            build_sweep();
+            traverse_ast_visit(node, fused_pre, fused_post, visit);
+            _FREE(pre_hooks);
+            _FREE(post_hooks);
+        }
+        sweep_ns += now_ns() - start;
+        num_sweeps++;
+    }
+
+    num_active = 0;
+    RET;
+}
+
+/**
+ * @brief Turn the timing of the passes on or off.
+ *
+ * @param state
+ *
+ */
+void set_pass_stats(bool state) {
+
+    pass_stats_state = state;
+}
+
+/**
+ * @brief Print the sweep, the number of calls, and the time of every pass.
+ *
+ */
+void report_pass_stats(void) {
+
+    uint64_t ns = 0;
+
+    printf("\nPass statistics:\n");
+    printf("%-32s %6s %10s %10s\n", "pass", "sweep", "calls", "ms");
+    for(int i = 0; i < num_passes; i++) {
+        printf("%-32s %6d %10lu %10.3f\n", passes[i].name, passes[i].sweep + 1, passes[i].calls,
+               passes[i].ns / 1e6);
+        ns += passes[i].ns;
+    }
+    printf("%-32s %6s %10s %10.3f\n", "all passes", "", "", ns / 1e6);
+    printf("traversals: %d for %d passes, %.3f ms\n", num_sweeps, num_passes, sweep_ns / 1e6);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file passes.h
+ *
+ * @brief Public interface to the pass manager. Passes are registered with
+ * the passes that they depend on, and the manager runs as many of them as
+ * it can in each traversal of the AST.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef _PASSES_H_
+#define _PASSES_H_
+
+#include <stdbool.h>
+
+#include "ast.h"
+
+/*
+ * How a pass depends on another one.
+ */
+typedef enum {
+    // The other pass must have handled the node and everything above it.
+    // Both can run in the same traversal.
+    PASS_AFTER_NODE,
+    // The other pass must have handled the whole tree, so this one runs in
+    // a later traversal.
+    PASS_AFTER_TREE,
+} PassDep;
+
+/*
+ * The pre and post functions of a pass for each node type, indexed by the
+ * type less AST_FIRST. A type that has neither is not given to the pass.
+ */
+typedef struct {
+    PassFunc pre[AST_LAST - AST_FIRST];
+    PassFunc post[AST_LAST - AST_FIRST];
+} PassTable;
+
+void register_pass(const char* name, PassFunc pre, PassFunc post);
+void register_pass_table(const char* name, const PassTable* table);
+void require_pass(const char* name, const char* dep, PassDep kind);
+void run_passes(ast_module* node);
+void set_pass_stats(bool state);
+void report_pass_stats(void);
+
+#endif /* _PASSES_H_ */
@@ -17,240 +17,82 @@
 
 
 /**
- * @brief This function calls the test pass function. This way, there can be
- * only the elements that are active in the array. There must be a dummy
- * function that does nothing if a node is entered without a handler. There
- * are no actual restrictions on the signature of the function called, but
- * all of the information needed by the pass function must be provided in the
- * AST node. This function should be used as a template for other passes.
+ * @brief Define the name context and the scope of a namespace.
  *
  * @param node
- * @param type
- * @return * void
  *
  */
-void pre_sym_pass(ast_node* node) {
+static void pre_namespace_definition(ast_node* node) {
 
     ENTER;
     TRACE("node type: %s", nterm_to_str(node));
 
-    // Define the name context for the namespace.
-    switch(ast_node_type(node)) {
-        case AST_namespace_definition: {  
-            ast_namespace_definition* n = (ast_namespace_definition*)node;
-            push_sym_context(raw_string(n->name->str)); 
-            n->context = copy_root_context();
-            const char* s = get_sym_context(n->context);
-            create_symtab_node(s, node);
-            TRACE("context: %s", s);
-        }
-        break;
-        
-        // Define the name context for the class.
-        case AST_class_definition: {
-            ast_class_definition* n = (ast_class_definition*)node;
-            push_sym_context(raw_string(n->name->str)); 
-            n->context = copy_root_context();
-            const char* s = get_sym_context(n->context);
-            create_symtab_node(s, node);
-            TRACE("context: %s", s);
-        }
-        break;
-
-        // A var declaration may be part of a definition with an initializer,
-        // but this will define the name in the symbol table.
-        case AST_var_decl:
-            break;
-
-        // Function declarations are only valid in a class.
-        case AST_function_declaration:
-            break;
-
-        // Create the unique create name. Can only be declared in a class.
-        case AST_create_declaration:
-            break;
-
-        // Create the unique destroy name. Can only be declared in a class.
-        case AST_destroy_declaration:
-            break;
-
-        // Create the name if it has not been declared in a class. Creates a 
-        // unique context for the variables that are referenced in the 
-        // function, but the names in a class of which the function was 
-        // declared are local to this context. Input and output parameters are
-        // local to the function, 
-        case AST_function_definition:
-            break;
+    ast_namespace_definition* n = (ast_namespace_definition*)node;
+    push_sym_context(n->name->sym);
+    n->context = copy_root_context();
+    enter_symtab_scope(n->name->sym, node);
+    TRACE("context: %s", get_sym_context(n->context));
+    RET;
+}
 
-        // Create an anonymous name context scope.
-        case AST_function_body:
-            break;
+static void post_namespace_definition(ast_node* node) {
 
-        // None of these productions define a new name.
-        case AST_module:
-        case AST_module_item:
-        case AST_namespace_item:
-        case AST_class_item:
-        case AST_compound_name:
-        case AST_compound_ref_item:
-        case AST_compound_reference:
-        case AST_scope_operator:
-        case AST_literal_type_name:
-        case AST_literal_value:
-        case AST_type_name:
-        case AST_formatted_strg:
-        case AST_string_literal:
-        case AST_var_decl_list:
-        case AST_var_definition:
-        case AST_list_init:
-        case AST_dict_init_element:
-        case AST_dict_init:
-        case AST_array_param:
-        case AST_array_reference:
-        case AST_function_reference:
-        case AST_create_reference:
-        case AST_destroy_reference:
-        case AST_create_name:
-        case AST_destroy_name:
-        case AST_create_definition:
-        case AST_destroy_definition:
-        case AST_function_body_element:
-        case AST_expression:
-        case AST_expr_primary:
-        case AST_expression_list:
-        case AST_assignment_item:
-        case AST_assignment:
-        case AST_while_definition:
-        case AST_while_clause:
-        case AST_do_clause:
-        case AST_for_clause:
-        case AST_if_clause:
-        case AST_else_clause:
-        case AST_elif_clause:
-        case AST_try_clause:
-        case AST_except_clause:
-        case AST_final_clause:
-        case AST_break_statement:
-        case AST_continue_statement:
-        case AST_inline_statement:
-        case AST_yield_statement:
-        case AST_return_statement:
-        case AST_raise_statement:
-        case AST_start_function:
-        case AST_import_statement:
-        case AST_operator:
-        case AST_cast_statement:
-        case AST_case_item:
-        case AST_type_name_list:
-        case AST_function_assignment:
-        case AST_compound_name_list:
-        case AST_array_param_list:
-        case AST_class_var_declaration:
-        case AST_print_statement:
-        case AST_trace_statement:
-        case AST_exit_statement:        
-            break;
+    ENTER;
+    TRACE("node type: %s", nterm_to_str(node));
 
-        default:                        
-            fatal_error("Unknown non-terminal type in %s: %d", __func__, node->type);
-    }
+    ast_namespace_definition* n = (ast_namespace_definition*)node;
+    pop_sym_context();
+    leave_symtab_scope();
+    const char* s = get_sym_context(n->context);
+    TRACE("context: %s", s);
     RET;
 }
 
-void post_sym_pass(ast_node* node) {
+/**
+ * @brief Define the name context and the scope of a class.
+ *
+ * @param node
+ *
+ */
+static void pre_class_definition(ast_node* node) {
 
     ENTER;
     TRACE("node type: %s", nterm_to_str(node));
 
-    switch(ast_node_type(node)) {
-        case AST_namespace_definition: { 
-            ast_namespace_definition* n = (ast_namespace_definition*)node;
-            pop_sym_context(); 
-            const char* s = get_sym_context(n->context);
-            TRACE("context: %s", s);
-            break;
-        }
+    ast_class_definition* n = (ast_class_definition*)node;
+    push_sym_context(n->name->sym);
+    n->context = copy_root_context();
+    enter_symtab_scope(n->name->sym, node);
+    TRACE("context: %s", get_sym_context(n->context));
+    RET;
+}
 
-        case AST_class_definition: {
-            ast_class_definition* n = (ast_class_definition*)node;
-            pop_sym_context(); 
-            const char* s = get_sym_context(n->context);
-            TRACE("context: %s", s);
-            break;
-        }
+static void post_class_definition(ast_node* node) {
 
-        case AST_module:
-        case AST_module_item:
-        case AST_namespace_item:
-        case AST_class_item:
-        case AST_compound_name:
-        case AST_compound_ref_item:
-        case AST_compound_reference:
-        case AST_scope_operator:
-        case AST_literal_type_name:
-        case AST_literal_value:
-        case AST_type_name:
-        case AST_formatted_strg:
-        case AST_string_literal:
-        case AST_var_decl:
-        case AST_var_decl_list:
-        case AST_var_definition:
-        case AST_list_init:
-        case AST_dict_init_element:
-        case AST_dict_init:
-        case AST_array_param:
-        case AST_array_reference:
-        case AST_function_reference:
-        case AST_create_reference:
-        case AST_destroy_reference:
-        case AST_function_declaration:
-        case AST_create_declaration:
-        case AST_destroy_declaration:
-        case AST_function_definition:
-        case AST_create_name:
-        case AST_destroy_name:
-        case AST_create_definition:
-        case AST_destroy_definition:
-        case AST_function_body:
-        case AST_function_body_element:
-        case AST_expression:
-        case AST_expr_primary:
-        case AST_expression_list:
-        case AST_assignment_item:
-        case AST_assignment:
-        case AST_while_definition:
-        case AST_while_clause:
-        case AST_do_clause:
-        case AST_for_clause:
-        case AST_if_clause:
-        case AST_else_clause:
-        case AST_elif_clause:
-        case AST_try_clause:
-        case AST_except_clause:
-        case AST_final_clause:
-        case AST_break_statement:
-        case AST_continue_statement:
-        case AST_inline_statement:
-        case AST_yield_statement:
-        case AST_return_statement:
-        case AST_raise_statement:
-        case AST_start_function:
-        case AST_import_statement:
-        case AST_operator:
-        case AST_cast_statement:
-        case AST_case_item:
-        case AST_type_name_list:
-        case AST_function_assignment:
-        case AST_compound_name_list:
-        case AST_array_param_list:
-        case AST_class_var_declaration:
-        case AST_print_statement:
-        case AST_trace_statement:
-        case AST_exit_statement:
-            break;
+    ENTER;
+    TRACE("node type: %s", nterm_to_str(node));
 
-        default:
-            fatal_error("Unknown non-terminal type in %s: %d", __func__, node->type);
-    }
+    ast_class_definition* n = (ast_class_definition*)node;
+    pop_sym_context();
+    leave_symtab_scope();
+    const char* s = get_sym_context(n->context);
+    TRACE("context: %s", s);
     RET;
 }
+
+/*
+ * Only the namespaces and the classes define names so far. A var
+ * declaration, a function, a create, and a destroy will define names in
+ * their scopes, and a function body will get an anonymous scope. The
+ * subtrees that cannot hold any of these are not traversed.
+ */
+const PassTable sym_pass = {
+    .pre = {
+        [AST_namespace_definition - AST_FIRST] = pre_namespace_definition,
+        [AST_class_definition - AST_FIRST]     = pre_class_definition,
+    },
+    .post = {
+        [AST_namespace_definition - AST_FIRST] = post_namespace_definition,
+        [AST_class_definition - AST_FIRST]     = post_class_definition,
+    },
+};
@@ -11,9 +11,9 @@
 #ifndef _SYMPASS_H_
 #define _SYMPASS_H_
 #include "ast.h"
+#include "passes.h"
 #include "symbols.h"
 
-void pre_sym_pass(ast_node* node);
-void post_sym_pass(ast_node* node);
+extern const PassTable sym_pass;
 
 #endif  /* _SYMPASS_H_ */
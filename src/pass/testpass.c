@@ -10,6 +10,7 @@
  * @copyright Copyright (c) 2024
  */
 #include "parse.h"
+#include "testpass.h"
 #include "trace.h"
 
 
@@ -36,194 +37,162 @@ void post_test_pass_func(ast_node* node, int number) {
 }
 
 /**
- * @brief This function specifically does nothing. It is called when none of
- * the nodes are a match in the pre_test_pass().
- */
-void dummy_function(void) {
-
-    ENTER;
-    TRACE("dummy function");
-    RET;
-}
-
-/**
- * @brief This function calls the test pass function. This way, there can be
- * only the elements that are active in the array. There must be a dummy
- * function that does nothing if a node is entered without a handler. There
- * are no actual restrictions on the signature of the function called, but
- * all of the information needed by the pass function must be provided in the
- * AST node. This function should be used as a template for other passes.
+ * @brief Call the test pass functions with the type of the node as the
+ * number.
  *
  * @param node
- * @param type
- * @return * void
  *
  */
-void pre_test_pass(ast_node* node) {
-
-    AstType type = ast_node_type(node);
+static void pre_test(ast_node* node) {
 
-    (type == AST_module) ? pre_test_pass_func(node, AST_module) :
-            (type == AST_module_item) ?
-                           pre_test_pass_func(node, AST_module_item) :
-            (type == AST_namespace_item) ?
-                           pre_test_pass_func(node, AST_namespace_item) :
-            (type == AST_namespace_definition) ?
-                           pre_test_pass_func(node, AST_namespace_definition) :
-            (type == AST_class_item) ?
-                           pre_test_pass_func(node, AST_class_item) :
-            (type == AST_class_definition) ?
-                           pre_test_pass_func(node, AST_class_definition) :
-            (type == AST_compound_name) ?
-                           pre_test_pass_func(node, AST_compound_name) :
-            (type == AST_compound_ref_item) ?
-                           pre_test_pass_func(node, AST_compound_ref_item) :
-            (type == AST_compound_reference) ?
-                           pre_test_pass_func(node, AST_compound_reference) :
-            (type == AST_scope_operator) ?
-                           pre_test_pass_func(node, AST_scope_operator) :
-            (type == AST_literal_type_name) ?
-                           pre_test_pass_func(node, AST_literal_type_name) :
-            (type == AST_literal_value) ? pre_test_pass_func(node, AST_literal_value) :
-            (type == AST_type_name) ? pre_test_pass_func(node, AST_type_name) :
-            (type == AST_formatted_strg) ? pre_test_pass_func(node, AST_formatted_strg) :
-            (type == AST_string_literal) ? pre_test_pass_func(node, AST_string_literal) :
-            (type == AST_var_decl) ? pre_test_pass_func(node, AST_var_decl) :
-            (type == AST_var_decl_list) ? pre_test_pass_func(node, AST_var_decl_list) :
-            (type == AST_var_definition) ? pre_test_pass_func(node, AST_var_definition) :
-            (type == AST_list_init) ? pre_test_pass_func(node, AST_list_init) :
-            (type == AST_dict_init_element) ?
-                                      pre_test_pass_func(node, AST_dict_init_element) :
-            (type == AST_dict_init) ? pre_test_pass_func(node, AST_dict_init) :
-            (type == AST_array_param) ? pre_test_pass_func(node, AST_array_param) :
-            (type == AST_array_reference) ? pre_test_pass_func(node, AST_array_reference) :
-            (type == AST_function_reference) ? pre_test_pass_func(node, AST_function_reference) :
-            (type == AST_create_reference) ? pre_test_pass_func(node, AST_create_reference) :
-            (type == AST_destroy_reference) ? pre_test_pass_func(node, AST_destroy_reference) :
-            (type == AST_function_declaration) ? pre_test_pass_func(node, AST_function_declaration) :
-            (type == AST_create_declaration) ? pre_test_pass_func(node, AST_create_declaration) :
-            (type == AST_destroy_declaration) ? pre_test_pass_func(node, AST_destroy_declaration) :
-            (type == AST_function_definition) ? pre_test_pass_func(node, AST_function_definition) :
-            (type == AST_create_name) ? pre_test_pass_func(node, AST_create_name) :
-            (type == AST_destroy_name) ? pre_test_pass_func(node, AST_destroy_name) :
-            (type == AST_create_definition) ? pre_test_pass_func(node, AST_create_definition) :
-            (type == AST_destroy_definition) ? pre_test_pass_func(node, AST_destroy_definition) :
-            (type == AST_function_body) ? pre_test_pass_func(node, AST_function_body) :
-            (type == AST_function_body_element) ?
-                                          pre_test_pass_func(node, AST_function_body_element) :
-            (type == AST_expression) ? pre_test_pass_func(node, AST_expression) :
-            (type == AST_expr_primary) ? pre_test_pass_func(node, AST_expr_primary) :
-            (type == AST_expression_list) ? pre_test_pass_func(node, AST_expression_list) :
-            (type == AST_assignment_item) ? pre_test_pass_func(node, AST_assignment_item) :
-            (type == AST_assignment) ? pre_test_pass_func(node, AST_assignment) :
-            (type == AST_while_definition) ? pre_test_pass_func(node, AST_while_definition) :
-            (type == AST_while_clause) ? pre_test_pass_func(node, AST_while_clause) :
-            (type == AST_do_clause)  ? pre_test_pass_func(node, AST_do_clause) :
-            (type == AST_for_clause) ? pre_test_pass_func(node, AST_for_clause) :
-            (type == AST_if_clause)  ? pre_test_pass_func(node, AST_if_clause) :
-            (type == AST_elif_clause) ? pre_test_pass_func(node, AST_elif_clause) :
-            (type == AST_else_clause) ? pre_test_pass_func(node, AST_else_clause) :
-            (type == AST_try_clause) ? pre_test_pass_func(node, AST_try_clause) :
-            (type == AST_final_clause) ? pre_test_pass_func(node, AST_final_clause) :
-            (type == AST_except_clause) ? pre_test_pass_func(node, AST_except_clause) :
-            (type == AST_break_statement) ? pre_test_pass_func(node, AST_break_statement) :
-            (type == AST_continue_statement) ? pre_test_pass_func(node, AST_continue_statement) :
-            (type == AST_inline_statement) ? pre_test_pass_func(node, AST_inline_statement) :
-            (type == AST_yield_statement) ? pre_test_pass_func(node, AST_yield_statement) :
-            (type == AST_exit_statement) ? pre_test_pass_func(node, AST_exit_statement) :
-            (type == AST_return_statement) ? pre_test_pass_func(node, AST_return_statement) :
-            (type == AST_raise_statement) ? pre_test_pass_func(node, AST_raise_statement) :
-            (type == AST_start_function) ? pre_test_pass_func(node, AST_start_function) :
-            (type == AST_import_statement) ? pre_test_pass_func(node, AST_import_statement) :
-            (type == AST_operator) ? pre_test_pass_func(node, AST_operator) :
-            (type == AST_cast_statement) ? pre_test_pass_func(node, AST_cast_statement) :
-            (type == AST_case_item) ? pre_test_pass_func(node, AST_case_item) :
-            (type == AST_class_var_declaration) ?
-                                      pre_test_pass_func(node, AST_class_var_declaration) :
-                                      dummy_function();
+    pre_test_pass_func(node, ast_node_type(node));
 }
 
-void post_test_pass(ast_node* node) {
-
-    AstType type = ast_node_type(node);
+static void post_test(ast_node* node) {
 
-    (type == AST_module) ? post_test_pass_func(node, AST_module) :
-            (type == AST_module_item) ?
-                           post_test_pass_func(node, AST_module_item) :
-            (type == AST_namespace_item) ?
-                           post_test_pass_func(node, AST_namespace_item) :
-            (type == AST_namespace_definition) ?
-                           post_test_pass_func(node, AST_namespace_definition) :
-            (type == AST_class_item) ?
-                           post_test_pass_func(node, AST_class_item) :
-            (type == AST_class_definition) ?
-                           post_test_pass_func(node, AST_class_definition) :
-            (type == AST_compound_name) ?
-                           post_test_pass_func(node, AST_compound_name) :
-            (type == AST_compound_ref_item) ?
-                           post_test_pass_func(node, AST_compound_ref_item) :
-            (type == AST_compound_reference) ?
-                           post_test_pass_func(node, AST_compound_reference) :
-            (type == AST_scope_operator) ?
-                           post_test_pass_func(node, AST_scope_operator) :
-            (type == AST_literal_type_name) ?
-                           post_test_pass_func(node, AST_literal_type_name) :
-            (type == AST_literal_value) ? post_test_pass_func(node, AST_literal_value) :
-            (type == AST_type_name) ? post_test_pass_func(node, AST_type_name) :
-            (type == AST_formatted_strg) ? post_test_pass_func(node, AST_formatted_strg) :
-            (type == AST_string_literal) ? post_test_pass_func(node, AST_string_literal) :
-            (type == AST_var_decl) ? post_test_pass_func(node, AST_var_decl) :
-            (type == AST_var_decl_list) ? post_test_pass_func(node, AST_var_decl_list) :
-            (type == AST_var_definition) ? post_test_pass_func(node, AST_var_definition) :
-            (type == AST_list_init) ? post_test_pass_func(node, AST_list_init) :
-            (type == AST_dict_init_element) ?
-                                      post_test_pass_func(node, AST_dict_init_element) :
-            (type == AST_dict_init) ? post_test_pass_func(node, AST_dict_init) :
-            (type == AST_array_param) ? post_test_pass_func(node, AST_array_param) :
-            (type == AST_array_reference) ? post_test_pass_func(node, AST_array_reference) :
-            (type == AST_function_reference) ? post_test_pass_func(node, AST_function_reference) :
-            (type == AST_create_reference) ? post_test_pass_func(node, AST_create_reference) :
-            (type == AST_destroy_reference) ? post_test_pass_func(node, AST_destroy_reference) :
-            (type == AST_function_declaration) ? post_test_pass_func(node, AST_function_declaration) :
-            (type == AST_create_declaration) ? post_test_pass_func(node, AST_create_declaration) :
-            (type == AST_destroy_declaration) ? post_test_pass_func(node, AST_destroy_declaration) :
-            (type == AST_function_definition) ? post_test_pass_func(node, AST_function_definition) :
-            (type == AST_create_name) ? post_test_pass_func(node, AST_create_name) :
-            (type == AST_destroy_name) ? post_test_pass_func(node, AST_destroy_name) :
-            (type == AST_create_definition) ? post_test_pass_func(node, AST_create_definition) :
-            (type == AST_destroy_definition) ? post_test_pass_func(node, AST_destroy_definition) :
-            (type == AST_function_body) ? post_test_pass_func(node, AST_function_body) :
-            (type == AST_function_body_element) ?
-                                          post_test_pass_func(node, AST_function_body_element) :
-            (type == AST_expression) ? post_test_pass_func(node, AST_expression) :
-            (type == AST_expr_primary) ? post_test_pass_func(node, AST_expr_primary) :
-            (type == AST_expression_list) ? post_test_pass_func(node, AST_expression_list) :
-            (type == AST_assignment_item) ? post_test_pass_func(node, AST_assignment_item) :
-            (type == AST_assignment) ? post_test_pass_func(node, AST_assignment) :
-            (type == AST_while_definition) ? post_test_pass_func(node, AST_while_definition) :
-            (type == AST_while_clause) ? post_test_pass_func(node, AST_while_clause) :
-            (type == AST_do_clause) ? post_test_pass_func(node, AST_do_clause) :
-            (type == AST_for_clause) ? post_test_pass_func(node, AST_for_clause) :
-            (type == AST_if_clause) ? post_test_pass_func(node, AST_if_clause) :
-            (type == AST_else_clause) ? post_test_pass_func(node, AST_else_clause) :
-            (type == AST_elif_clause) ? post_test_pass_func(node, AST_elif_clause) :
-            (type == AST_try_clause) ? post_test_pass_func(node, AST_try_clause) :
-            (type == AST_except_clause) ? post_test_pass_func(node, AST_except_clause) :
-            (type == AST_final_clause) ? post_test_pass_func(node, AST_final_clause) :
-            (type == AST_break_statement) ? post_test_pass_func(node, AST_break_statement) :
-            (type == AST_continue_statement) ? post_test_pass_func(node, AST_continue_statement) :
-            (type == AST_inline_statement) ? post_test_pass_func(node, AST_inline_statement) :
-            (type == AST_yield_statement) ? post_test_pass_func(node, AST_yield_statement) :
-            (type == AST_exit_statement) ? post_test_pass_func(node, AST_exit_statement) :
-            (type == AST_return_statement) ? post_test_pass_func(node, AST_return_statement) :
-            (type == AST_raise_statement) ? post_test_pass_func(node, AST_raise_statement) :
-            (type == AST_start_function) ? post_test_pass_func(node, AST_start_function) :
-            (type == AST_import_statement) ? post_test_pass_func(node, AST_import_statement) :
-            (type == AST_operator) ? post_test_pass_func(node, AST_operator) :
-            (type == AST_cast_statement) ? post_test_pass_func(node, AST_cast_statement) :
-            (type == AST_case_item) ? post_test_pass_func(node, AST_case_item) :
-            (type == AST_class_var_declaration) ?
-                                      pre_test_pass_func(node, AST_class_var_declaration) :
-
-                                      dummy_function();
+    post_test_pass_func(node, ast_node_type(node));
 }
+
+/*
+ * This table should be used as a template for other passes. Only the types
+ * that have a function are given to the pass, so there is no need for a
+ * function that does nothing when a node is entered without a handler. All
+ * of the information needed by the pass function must be provided in the
+ * AST node.
+ */
+const PassTable test_pass = {
+    .pre = {
+        [AST_module - AST_FIRST]                = pre_test,
+        [AST_module_item - AST_FIRST]           = pre_test,
+        [AST_namespace_item - AST_FIRST]        = pre_test,
+        [AST_namespace_definition - AST_FIRST]  = pre_test,
+        [AST_class_item - AST_FIRST]            = pre_test,
+        [AST_class_definition - AST_FIRST]      = pre_test,
+        [AST_compound_name - AST_FIRST]         = pre_test,
+        [AST_compound_ref_item - AST_FIRST]     = pre_test,
+        [AST_compound_reference - AST_FIRST]    = pre_test,
+        [AST_scope_operator - AST_FIRST]        = pre_test,
+        [AST_literal_type_name - AST_FIRST]     = pre_test,
+        [AST_literal_value - AST_FIRST]         = pre_test,
+        [AST_type_name - AST_FIRST]             = pre_test,
+        [AST_formatted_strg - AST_FIRST]        = pre_test,
+        [AST_string_literal - AST_FIRST]        = pre_test,
+        [AST_var_decl - AST_FIRST]              = pre_test,
+        [AST_var_decl_list - AST_FIRST]         = pre_test,
+        [AST_var_definition - AST_FIRST]        = pre_test,
+        [AST_list_init - AST_FIRST]             = pre_test,
+        [AST_dict_init_element - AST_FIRST]     = pre_test,
+        [AST_dict_init - AST_FIRST]             = pre_test,
+        [AST_array_param - AST_FIRST]           = pre_test,
+        [AST_array_reference - AST_FIRST]       = pre_test,
+        [AST_function_reference - AST_FIRST]    = pre_test,
+        [AST_create_reference - AST_FIRST]      = pre_test,
+        [AST_destroy_reference - AST_FIRST]     = pre_test,
+        [AST_function_declaration - AST_FIRST]  = pre_test,
+        [AST_create_declaration - AST_FIRST]    = pre_test,
+        [AST_destroy_declaration - AST_FIRST]   = pre_test,
+        [AST_function_definition - AST_FIRST]   = pre_test,
+        [AST_create_name - AST_FIRST]           = pre_test,
+        [AST_destroy_name - AST_FIRST]          = pre_test,
+        [AST_create_definition - AST_FIRST]     = pre_test,
+        [AST_destroy_definition - AST_FIRST]    = pre_test,
+        [AST_function_body - AST_FIRST]         = pre_test,
+        [AST_function_body_element - AST_FIRST] = pre_test,
+        [AST_expression - AST_FIRST]            = pre_test,
+        [AST_expr_primary - AST_FIRST]          = pre_test,
+        [AST_expression_list - AST_FIRST]       = pre_test,
+        [AST_assignment_item - AST_FIRST]       = pre_test,
+        [AST_assignment - AST_FIRST]            = pre_test,
+        [AST_while_definition - AST_FIRST]      = pre_test,
+        [AST_while_clause - AST_FIRST]          = pre_test,
+        [AST_do_clause - AST_FIRST]             = pre_test,
+        [AST_for_clause - AST_FIRST]            = pre_test,
+        [AST_if_clause - AST_FIRST]             = pre_test,
+        [AST_elif_clause - AST_FIRST]           = pre_test,
+        [AST_else_clause - AST_FIRST]           = pre_test,
+        [AST_try_clause - AST_FIRST]            = pre_test,
+        [AST_final_clause - AST_FIRST]          = pre_test,
+        [AST_except_clause - AST_FIRST]         = pre_test,
+        [AST_break_statement - AST_FIRST]       = pre_test,
+        [AST_continue_statement - AST_FIRST]    = pre_test,
+        [AST_inline_statement - AST_FIRST]      = pre_test,
+        [AST_yield_statement - AST_FIRST]       = pre_test,
+        [AST_exit_statement - AST_FIRST]        = pre_test,
+        [AST_return_statement - AST_FIRST]      = pre_test,
+        [AST_raise_statement - AST_FIRST]       = pre_test,
+        [AST_start_function - AST_FIRST]        = pre_test,
+        [AST_import_statement - AST_FIRST]      = pre_test,
+        [AST_expr_binary - AST_FIRST]           = pre_test,
+        [AST_expr_unary - AST_FIRST]            = pre_test,
+        [AST_cast_statement - AST_FIRST]        = pre_test,
+        [AST_case_item - AST_FIRST]             = pre_test,
+        [AST_class_var_declaration - AST_FIRST] = pre_test,
+    },
+    .post = {
+        [AST_module - AST_FIRST]                = post_test,
+        [AST_module_item - AST_FIRST]           = post_test,
+        [AST_namespace_item - AST_FIRST]        = post_test,
+        [AST_namespace_definition - AST_FIRST]  = post_test,
+        [AST_class_item - AST_FIRST]            = post_test,
+        [AST_class_definition - AST_FIRST]      = post_test,
+        [AST_compound_name - AST_FIRST]         = post_test,
+        [AST_compound_ref_item - AST_FIRST]     = post_test,
+        [AST_compound_reference - AST_FIRST]    = post_test,
+        [AST_scope_operator - AST_FIRST]        = post_test,
+        [AST_literal_type_name - AST_FIRST]     = post_test,
+        [AST_literal_value - AST_FIRST]         = post_test,
+        [AST_type_name - AST_FIRST]             = post_test,
+        [AST_formatted_strg - AST_FIRST]        = post_test,
+        [AST_string_literal - AST_FIRST]        = post_test,
+        [AST_var_decl - AST_FIRST]              = post_test,
+        [AST_var_decl_list - AST_FIRST]         = post_test,
+        [AST_var_definition - AST_FIRST]        = post_test,
+        [AST_list_init - AST_FIRST]             = post_test,
+        [AST_dict_init_element - AST_FIRST]     = post_test,
+        [AST_dict_init - AST_FIRST]             = post_test,
+        [AST_array_param - AST_FIRST]           = post_test,
+        [AST_array_reference - AST_FIRST]       = post_test,
+        [AST_function_reference - AST_FIRST]    = post_test,
+        [AST_create_reference - AST_FIRST]      = post_test,
+        [AST_destroy_reference - AST_FIRST]     = post_test,
+        [AST_function_declaration - AST_FIRST]  = post_test,
+        [AST_create_declaration - AST_FIRST]    = post_test,
+        [AST_destroy_declaration - AST_FIRST]   = post_test,
+        [AST_function_definition - AST_FIRST]   = post_test,
+        [AST_create_name - AST_FIRST]           = post_test,
+        [AST_destroy_name - AST_FIRST]          = post_test,
+        [AST_create_definition - AST_FIRST]     = post_test,
+        [AST_destroy_definition - AST_FIRST]    = post_test,
+        [AST_function_body - AST_FIRST]         = post_test,
+        [AST_function_body_element - AST_FIRST] = post_test,
+        [AST_expression - AST_FIRST]            = post_test,
+        [AST_expr_primary - AST_FIRST]          = post_test,
+        [AST_expression_list - AST_FIRST]       = post_test,
+        [AST_assignment_item - AST_FIRST]       = post_test,
+        [AST_assignment - AST_FIRST]            = post_test,
+        [AST_while_definition - AST_FIRST]      = post_test,
+        [AST_while_clause - AST_FIRST]          = post_test,
+        [AST_do_clause - AST_FIRST]             = post_test,
+        [AST_for_clause - AST_FIRST]            = post_test,
+        [AST_if_clause - AST_FIRST]             = post_test,
+        [AST_else_clause - AST_FIRST]           = post_test,
+        [AST_elif_clause - AST_FIRST]           = post_test,
+        [AST_try_clause - AST_FIRST]            = post_test,
+        [AST_except_clause - AST_FIRST]         = post_test,
+        [AST_final_clause - AST_FIRST]          = post_test,
+        [AST_break_statement - AST_FIRST]       = post_test,
+        [AST_continue_statement - AST_FIRST]    = post_test,
+        [AST_inline_statement - AST_FIRST]      = post_test,
+        [AST_yield_statement - AST_FIRST]       = post_test,
+        [AST_exit_statement - AST_FIRST]        = post_test,
+        [AST_return_statement - AST_FIRST]      = post_test,
+        [AST_raise_statement - AST_FIRST]       = post_test,
+        [AST_start_function - AST_FIRST]        = post_test,
+        [AST_import_statement - AST_FIRST]      = post_test,
+        [AST_expr_binary - AST_FIRST]           = post_test,
+        [AST_expr_unary - AST_FIRST]            = post_test,
+        [AST_cast_statement - AST_FIRST]        = post_test,
+        [AST_case_item - AST_FIRST]             = post_test,
+        [AST_class_var_declaration - AST_FIRST] = post_test,
+    },
+};
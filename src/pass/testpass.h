@@ -11,6 +11,11 @@
 #ifndef _PASS_H_
 #define _PASS_H_
 #include "ast.h"
+#include "passes.h"
 
+void pre_test_pass_func(ast_node* node, int number);
+void post_test_pass_func(ast_node* node, int number);
+
+extern const PassTable test_pass;
 
 #endif  /* _PASS_H_ */
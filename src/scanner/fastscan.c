@@ -0,0 +1,296 @@
+/**
+ * @file fastscan.c
+ *
+ * @brief Vectorized searches for the scanner. On x86 the SSE2 versions are
+ * the baseline because every 64 bit x86 has them. If the CPU supports AVX2
+ * then init_fastscan() switches to the 32 byte versions at runtime. Other
+ * targets use the plain C versions. All of the versions return the same
+ * thing and never read past the end of the buffer.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "fastscan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__SSE2__)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__)
+#define USE_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+/*
+ * White space is ' ' and the range '\t' to '\r'.
+ */
+static inline bool is_space(unsigned char ch) {
+
+    return ch == ' ' || (unsigned char)(ch - '\t') <= ('\r' - '\t');
+}
+
+/*************************************************************************
+ * Plain C versions. These also finish the tail of the buffer for the
+ * vector versions.
+ */
+static size_t skip_space_c(const unsigned char* buf, size_t len) {
+
+    size_t idx = 0;
+    while(idx < len && is_space(buf[idx]))
+        idx++;
+
+    return idx;
+}
+
+static size_t find_eol_c(const unsigned char* buf, size_t len) {
+
+    size_t idx = 0;
+    while(idx < len && buf[idx] != '\n' && buf[idx] != '\r')
+        idx++;
+
+    return idx;
+}
+
+static size_t find_squote_c(const unsigned char* buf, size_t len) {
+
+    size_t idx = 0;
+    while(idx < len && buf[idx] != '\'')
+        idx++;
+
+    return idx;
+}
+
+static size_t find_dquote_c(const unsigned char* buf, size_t len) {
+
+    size_t idx = 0;
+    while(idx < len && buf[idx] != '\"' && buf[idx] != '\\')
+        idx++;
+
+    return idx;
+}
+
+/*************************************************************************
+ * SSE2 versions. Each loop compares 16 characters at a time and builds a
+ * bit mask of the ones that stop the run.
+ */
+#ifdef USE_SSE2
+
+static inline unsigned space_mask_sse2(__m128i v) {
+
+    // (ch - '\t') <= 4 as unsigned, or ch == ' '
+    __m128i off = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+    __m128i rng = _mm_cmpeq_epi8(_mm_min_epu8(off, _mm_set1_epi8('\r' - '\t')), off);
+    __m128i spc = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+
+    return (unsigned)_mm_movemask_epi8(_mm_or_si128(rng, spc));
+}
+
+static size_t skip_space_sse2(const unsigned char* buf, size_t len) {
+
+    size_t idx = 0;
+    for(; idx + 16 <= len; idx += 16) {
+        __m128i v     = _mm_loadu_si128((const __m128i*)&buf[idx]);
+        unsigned mask = ~space_mask_sse2(v) & 0xFFFF;
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + skip_space_c(&buf[idx], len - idx);
+}
+
+static size_t find_eol_sse2(const unsigned char* buf, size_t len) {
+
+    const __m128i nl = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+
+    size_t idx = 0;
+    for(; idx + 16 <= len; idx += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&buf[idx]);
+        unsigned mask =
+                (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, nl), _mm_cmpeq_epi8(v, cr)));
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + find_eol_c(&buf[idx], len - idx);
+}
+
+static size_t find_squote_sse2(const unsigned char* buf, size_t len) {
+
+    const __m128i sq = _mm_set1_epi8('\'');
+
+    size_t idx = 0;
+    for(; idx + 16 <= len; idx += 16) {
+        __m128i v     = _mm_loadu_si128((const __m128i*)&buf[idx]);
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, sq));
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + find_squote_c(&buf[idx], len - idx);
+}
+
+static size_t find_dquote_sse2(const unsigned char* buf, size_t len) {
+
+    const __m128i dq = _mm_set1_epi8('\"');
+    const __m128i bs = _mm_set1_epi8('\\');
+
+    size_t idx = 0;
+    for(; idx + 16 <= len; idx += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&buf[idx]);
+        unsigned mask =
+                (unsigned)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, dq), _mm_cmpeq_epi8(v, bs)));
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + find_dquote_c(&buf[idx], len - idx);
+}
+
+#endif /* USE_SSE2 */
+
+/*************************************************************************
+ * AVX2 versions. These are compiled for AVX2 regardless of the compiler
+ * flags and only called if the CPU says that it has it.
+ */
+#ifdef USE_AVX2
+
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 static inline unsigned space_mask_avx2(__m256i v) {
+
+    __m256i off = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    __m256i rng = _mm256_cmpeq_epi8(_mm256_min_epu8(off, _mm256_set1_epi8('\r' - '\t')), off);
+    __m256i spc = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+
+    return (unsigned)_mm256_movemask_epi8(_mm256_or_si256(rng, spc));
+}
+
+AVX2 static size_t skip_space_avx2(const unsigned char* buf, size_t len) {
+
+    size_t idx = 0;
+    for(; idx + 32 <= len; idx += 32) {
+        __m256i v     = _mm256_loadu_si256((const __m256i*)&buf[idx]);
+        unsigned mask = ~space_mask_avx2(v);
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + skip_space_c(&buf[idx], len - idx);
+}
+
+AVX2 static size_t find_eol_avx2(const unsigned char* buf, size_t len) {
+
+    const __m256i nl = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+
+    size_t idx = 0;
+    for(; idx + 32 <= len; idx += 32) {
+        __m256i v     = _mm256_loadu_si256((const __m256i*)&buf[idx]);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, nl), _mm256_cmpeq_epi8(v, cr)));
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + find_eol_c(&buf[idx], len - idx);
+}
+
+AVX2 static size_t find_squote_avx2(const unsigned char* buf, size_t len) {
+
+    const __m256i sq = _mm256_set1_epi8('\'');
+
+    size_t idx = 0;
+    for(; idx + 32 <= len; idx += 32) {
+        __m256i v     = _mm256_loadu_si256((const __m256i*)&buf[idx]);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, sq));
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + find_squote_c(&buf[idx], len - idx);
+}
+
+AVX2 static size_t find_dquote_avx2(const unsigned char* buf, size_t len) {
+
+    const __m256i dq = _mm256_set1_epi8('\"');
+    const __m256i bs = _mm256_set1_epi8('\\');
+
+    size_t idx = 0;
+    for(; idx + 32 <= len; idx += 32) {
+        __m256i v     = _mm256_loadu_si256((const __m256i*)&buf[idx]);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(v, dq), _mm256_cmpeq_epi8(v, bs)));
+        if(mask != 0)
+            return idx + __builtin_ctz(mask);
+    }
+
+    return idx + find_dquote_c(&buf[idx], len - idx);
+}
+
+#endif /* USE_AVX2 */
+
+/*************************************************************************
+ * API
+ */
+
+#ifdef USE_SSE2
+FastScan fast_scan = {
+    skip_space_sse2,
+    find_eol_sse2,
+    find_squote_sse2,
+    find_dquote_sse2,
+};
+static const char* fast_scan_name = "sse2";
+#else
+FastScan fast_scan = {
+    skip_space_c,
+    find_eol_c,
+    find_squote_c,
+    find_dquote_c,
+};
+static const char* fast_scan_name = "c";
+#endif
+
+static pthread_once_t fast_scan_once = PTHREAD_ONCE_INIT;
+
+static void select_fastscan(void) {
+
+#ifdef USE_AVX2
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        fast_scan.skip_space  = skip_space_avx2;
+        fast_scan.find_eol    = find_eol_avx2;
+        fast_scan.find_squote = find_squote_avx2;
+        fast_scan.find_dquote = find_dquote_avx2;
+        fast_scan_name        = "avx2";
+    }
+#endif
+}
+
+/**
+ * @brief Select the best versions of the search functions for the CPU that
+ * this is running on. Until this is called, the baseline versions are used.
+ * The table is shared by every thread, so it is only set the first time.
+ */
+void init_fastscan(void) {
+
+    pthread_once(&fast_scan_once, select_fastscan);
+}
+
+/**
+ * @brief Return the name of the versions that are in use.
+ *
+ * @return const char*
+ */
+const char* fastscan_name(void) {
+
+    return fast_scan_name;
+}
@@ -0,0 +1,34 @@
+/**
+ * @file fastscan.h
+ *
+ * @brief Search the input buffer for the end of long runs of characters
+ * that the scanner does not need to look at one at a time. These are used
+ * for white space, comments, and the bodies of quoted strings. Each
+ * function returns the index of the first character that stops the run, or
+ * the length of the buffer if the run goes to the end of it.
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#ifndef __FASTSCAN_H__
+#define __FASTSCAN_H__
+
+#include <stddef.h>
+
+typedef size_t (*FastScanFunc)(const unsigned char* buf, size_t len);
+
+typedef struct {
+    FastScanFunc skip_space;  // stop on anything that is not white space
+    FastScanFunc find_eol;    // stop on a '\n' or a '\r'
+    FastScanFunc find_squote; // stop on a '\''
+    FastScanFunc find_dquote; // stop on a '\"' or a '\\'
+} FastScan;
+
+extern FastScan fast_scan;
+
+void init_fastscan(void);
+const char* fastscan_name(void);
+
+#endif /* __FASTSCAN_H__ */
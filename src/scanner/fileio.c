@@ -14,11 +14,17 @@
  * @date 01-12-2024
  * @copyright Copyright (c) 2024
  */
+#include <assert.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "errors.h"
 #include "fileio.h"
@@ -26,37 +32,150 @@
 #include "sstrings.h"
 #include "trace.h"
 
+/*
+ * Every file that is opened is kept in the source file list for the life of
+ * the compile, even after it is popped from the stack. Tokens refer to the
+ * text of the file by the file's index in the list and an offset into the
+ * buffer.
+ */
+typedef struct {
+    const unsigned char* buffer; // whole file contents
+    size_t size;                 // number of bytes in the buffer
+    bool mapped;                 // buffer is mmap()ed rather than allocated
+    String* fname;               // name as it was opened
+} SourceFile;
+
+static _Thread_local SourceFile* source_files = NULL;
+static _Thread_local int num_source_files     = 0;
+static _Thread_local int cap_source_files     = 0;
+
 struct _file_ptr_ {
-    FILE* fp;
-    String* fname;
+    const unsigned char* buffer; // copied from the source file
+    size_t size;                 // copied from the source file
+    size_t pos;                  // index of the current character
+    int id;                      // index in the source file list
     int line_no;
     int col_no;
-    int ch;
     struct _file_ptr_* next;
 };
 
-static struct _file_ptr_* file_stack = NULL;
+static _Thread_local struct _file_ptr_* file_stack = NULL;
+
+/**
+ * @brief Read the whole of a file that cannot be mapped, such as a pipe, into
+ * a single allocated buffer.
+ *
+ * @param fd
+ * @param fname
+ * @param src
+ */
+static void read_input_file(int fd, const char* fname, SourceFile* src) {
+
+    size_t cap = 0x4000;
+    size_t len = 0;
+    unsigned char* buf = _ALLOC(cap);
+
+    while(true) {
+        if(len == cap) {
+            cap <<= 1;
+            buf = _REALLOC(buf, cap);
+        }
+
+        ssize_t n = read(fd, &buf[len], cap - len);
+        if(n > 0)
+            len += (size_t)n;
+        else if(n == 0)
+            break;
+        else if(errno != EINTR)
+            fatal_error("File Error: cannot read input file: %s: %s\n", fname, strerror(errno));
+    }
+
+    src->buffer = buf;
+    src->size   = len;
+    src->mapped = false;
+}
 
 /**
- * @brief Close the file on the top of the stack and pop it off of the stack,
- * making the previous file current.
+ * @brief Load a file into the source file list and return its index.
+ * Regular files are mapped into memory in one shot. Anything that cannot be
+ * mapped is read into a buffer in bulk.
+ *
+ * @param fname
+ * @return int
+ */
+static int load_source_file(const char* fname) {
+
+    int fd = open(fname, O_RDONLY);
+    if(fd < 0)
+        fatal_error("File Error: cannot open input file: %s: %s\n", fname, strerror(errno));
+
+    if(num_source_files + 1 > cap_source_files) {
+        cap_source_files = (cap_source_files == 0) ? 0x10 : cap_source_files << 1;
+        source_files     = _REALLOC_ARRAY(source_files, SourceFile, cap_source_files);
+    }
+
+    SourceFile* src = &source_files[num_source_files];
+    src->buffer     = NULL;
+    src->size       = 0;
+    src->mapped     = false;
+    src->fname      = create_string(fname);
+
+    struct stat st;
+    if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        if(st.st_size > 0) {
+            void* buf = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(buf != MAP_FAILED) {
+                madvise(buf, (size_t)st.st_size, MADV_SEQUENTIAL);
+                src->buffer = buf;
+                src->size   = (size_t)st.st_size;
+                src->mapped = true;
+            }
+            else
+                read_input_file(fd, fname, src);
+        }
+        // else an empty file has nothing to map
+    }
+    else
+        read_input_file(fd, fname, src);
+
+    close(fd);
+
+    return num_source_files++;
+}
+
+/**
+ * @brief Load a file into the source file list without reading from it and
+ * return its index. A file that was loaded before is not loaded again.
+ *
+ * @param fname
+ * @return int
+ */
+int load_source(const char* fname) {
+
+    int id = find_source_file(fname);
+    return (id >= 0) ? id : load_source_file(fname);
+}
+
+/**
+ * @brief Pop the file on the top of the stack, making the previous file
+ * current. The text of the file stays loaded because tokens refer to it.
  *
  */
 void pop_input_file(void) {
 
     ENTER;
     if(file_stack != NULL) {
-        fclose(file_stack->fp);
         struct _file_ptr_* tmp = file_stack;
         file_stack             = tmp->next;
-        destroy_string(tmp->fname);
         _FREE(tmp);
     }
     RET;
 }
 
 /**
- * @brief Open an input file and push it on the stack.
+ * @brief Open an input file and push it on the stack. The whole file is
+ * loaded when it is opened, so the character functions only ever walk a
+ * pointer.
  *
  * @param fname
  */
@@ -64,18 +183,16 @@ void push_input_file(const char* fname) {
 
     ENTER;
     TRACE("input file: %s", fname);
-    FILE* fp = fopen(fname, "r");
-    if(fp == NULL)
-        fatal_error("File Error: cannot open input file: %s: %s\n", fname, strerror(errno));
+    int id = load_source(fname);
 
     struct _file_ptr_* ptr = _ALLOC_T(struct _file_ptr_);
-    ptr->fp                = fp;
-    ptr->fname             = create_string(fname);
+    ptr->buffer            = source_files[id].buffer;
+    ptr->size              = source_files[id].size;
+    ptr->pos               = 0;
+    ptr->id                = id;
     ptr->line_no           = 1;
     ptr->col_no            = 1;
     ptr->next              = NULL;
-    // prime the pump
-    ptr->ch = fgetc(ptr->fp);
 
     // push it on the stack
     if(file_stack != NULL)
@@ -84,6 +201,36 @@ void push_input_file(const char* fname) {
     RET;
 }
 
+/**
+ * @brief Push part of a source file that was loaded before, so that it is
+ * read again from pos. The file ends at end as far as the scanner can see.
+ * The line and column are where pos is in the file.
+ *
+ * @param id
+ * @param pos
+ * @param end
+ * @param line_no
+ * @param col_no
+ */
+void push_input_range(int id, size_t pos, size_t end, int line_no, int col_no) {
+
+    ENTER;
+    assert(id >= 0 && id < num_source_files);
+    assert(pos <= end && end <= source_files[id].size);
+    TRACE("input range: %s: %lu to %lu", raw_string(source_files[id].fname), (unsigned long)pos, (unsigned long)end);
+
+    struct _file_ptr_* ptr = _ALLOC_T(struct _file_ptr_);
+    ptr->buffer            = source_files[id].buffer;
+    ptr->size              = end;
+    ptr->pos               = pos;
+    ptr->id                = id;
+    ptr->line_no           = line_no;
+    ptr->col_no            = col_no;
+    ptr->next              = file_stack;
+    file_stack             = ptr;
+    RET;
+}
+
 /**
  * @brief Return the current char or EOF if there is no more input.
  *
@@ -91,8 +238,12 @@ void push_input_file(const char* fname) {
  */
 int get_char(void) {
 
-    if(file_stack != NULL)
-        return file_stack->ch;
+    if(file_stack != NULL) {
+        if(file_stack->pos < file_stack->size)
+            return file_stack->buffer[file_stack->pos];
+        else
+            return END_OF_FILE;
+    }
     else
         return END_OF_INPUT;
 }
@@ -106,23 +257,158 @@ int get_char(void) {
 int consume_char(void) {
 
     if(file_stack != NULL) {
-        if(file_stack->ch == END_OF_FILE)
+        if(file_stack->pos >= file_stack->size)
             return END_OF_FILE;
-        else if(file_stack->ch == '\n') {
+        else if(file_stack->buffer[file_stack->pos] == '\n') {
             file_stack->line_no++;
             file_stack->col_no = 1;
         }
         else
             file_stack->col_no++;
 
-        // note that END_OF_FILE is equal to EOF
-        file_stack->ch = fgetc(file_stack->fp);
-        return file_stack->ch;
+        file_stack->pos++;
+        if(file_stack->pos < file_stack->size)
+            return file_stack->buffer[file_stack->pos];
+        else
+            return END_OF_FILE;
     }
     else
         return END_OF_INPUT;
 }
 
+/**
+ * @brief Return a pointer to the current character in the input buffer and
+ * the number of characters that are left in the file. This allows the
+ * scanner to search for the end of long runs of characters in bulk. Returns
+ * NULL if there is no open file.
+ *
+ * @param len
+ * @return const unsigned char*
+ */
+const unsigned char* get_input_buffer(size_t* len) {
+
+    if(file_stack != NULL) {
+        *len = file_stack->size - file_stack->pos;
+        return &file_stack->buffer[file_stack->pos];
+    }
+    else {
+        *len = 0;
+        return NULL;
+    }
+}
+
+/**
+ * @brief Consume a run of characters at once. The line and column are
+ * updated as if consume_char() had been called for each one of them. The
+ * count must not be more than get_input_buffer() returned.
+ *
+ * @param count
+ */
+void consume_chars(size_t count) {
+
+    if(file_stack != NULL && count > 0) {
+        const unsigned char* ptr  = &file_stack->buffer[file_stack->pos];
+        const unsigned char* end  = ptr + count;
+        const unsigned char* last = NULL;
+        const unsigned char* nl;
+
+        while(NULL != (nl = memchr(ptr, '\n', end - ptr))) {
+            file_stack->line_no++;
+            last = nl;
+            ptr  = nl + 1;
+        }
+
+        if(last != NULL)
+            file_stack->col_no = 1 + (int)(end - (last + 1));
+        else
+            file_stack->col_no += (int)count;
+
+        file_stack->pos += count;
+    }
+}
+
+/**
+ * @brief Return the source file id of the current file or -1 if there is no
+ * file open.
+ *
+ * @return int
+ */
+int get_file_id(void) {
+
+    if(file_stack != NULL)
+        return file_stack->id;
+    else
+        return -1;
+}
+
+/**
+ * @brief Return the offset of the current character in the current file.
+ *
+ * @return size_t
+ */
+size_t get_input_offset(void) {
+
+    if(file_stack != NULL)
+        return file_stack->pos;
+    else
+        return 0;
+}
+
+/**
+ * @brief Return the text of a source file that was opened before. The text
+ * is not zero terminated.
+ *
+ * @param id
+ * @return const unsigned char*
+ */
+const unsigned char* get_source_text(int id) {
+
+    assert(id >= 0 && id < num_source_files);
+    return source_files[id].buffer;
+}
+
+/**
+ * @brief Return the number of bytes in the text of a source file that was
+ * opened before.
+ *
+ * @param id
+ * @return size_t
+ */
+size_t get_source_size(int id) {
+
+    assert(id >= 0 && id < num_source_files);
+    return source_files[id].size;
+}
+
+/**
+ * @brief Return the name of a source file that was opened before, as it was
+ * opened.
+ *
+ * @param id
+ * @return const char*
+ */
+const char* get_source_name(int id) {
+
+    assert(id >= 0 && id < num_source_files);
+    return raw_string(source_files[id].fname);
+}
+
+/**
+ * @brief Return the ID of a source file that was opened before with the
+ * same name, or -1 if there is not one.
+ *
+ * @param fname
+ * @return int
+ */
+int find_source_file(const char* fname) {
+
+    for(int id = 0; id < num_source_files; id++)
+        if(!strcmp(raw_string(source_files[id].fname), fname))
+            return id;
+
+    return -1;
+}
+
 /**
  * @brief Return the line number of the current file. Returns -1 if there
  * is not currently open file.
@@ -159,7 +445,7 @@ int get_col_no(void) {
 const char* get_fname(void) {
 
     if(file_stack != NULL)
-        return raw_string(file_stack->fname);
+        return raw_string(source_files[file_stack->id].fname);
     else
         return NULL;
 }
@@ -11,13 +11,26 @@
 #ifndef __FILEIO_H__
 #define __FILEIO_H__
 
+#include <stddef.h>
+
 #define END_OF_FILE -1
 #define END_OF_INPUT -2
 
 void push_input_file(const char* fname);
+void push_input_range(int id, size_t pos, size_t end, int line_no, int col_no);
 void pop_input_file(void);
 int get_char(void);
 int consume_char(void);
+const unsigned char* get_input_buffer(size_t* len);
+void consume_chars(size_t count);
+
+int get_file_id(void);
+size_t get_input_offset(void);
+int load_source(const char* fname);
+const unsigned char* get_source_text(int id);
+size_t get_source_size(int id);
+const char* get_source_name(int id);
+int find_source_file(const char* fname);
 
 int get_line_no(void);
 int get_col_no(void);
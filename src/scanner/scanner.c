@@ -20,13 +20,15 @@
  * @copyright Copyright (c) 2024
  */
 #include <assert.h>
-#include <ctype.h>
+#include <stdarg.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 
 #include "except.h"
+#include "fastscan.h"
 #include "fileio.h"
 #include "memory.h"
 #include "scanner.h"
@@ -34,7 +36,230 @@
 #include "tokens.h"
 #include "trace.h"
 
-static Token token;
+static _Thread_local Token token;
+
+/*
+ * Every input byte belongs to exactly one character class. The classes are
+ * fine grained enough to drive the number state machine directly, so that
+ * each character costs one table lookup and no locale sensitive ctype
+ * calls are made.
+ */
+typedef enum {
+    CC_OTHER,  // control characters, DEL, and non-ASCII bytes
+    CC_SPACE,  // ' ', '\t', '\n', '\v', '\f', '\r'
+    CC_ZERO,   // '0'
+    CC_DIGIT,  // '1' - '9'
+    CC_HEX,    // letters that are hex digits, except for 'e'
+    CC_EXP,    // 'e' and 'E'
+    CC_X,      // 'x' and 'X'
+    CC_ALPHA,  // the rest of the letters
+    CC_UNDER,  // '_'
+    CC_DOT,    // '.'
+    CC_SIGN,   // '+' and '-'
+    CC_PUNCT,  // the rest of the printable punctuation
+    CC_SEMI,   // ';' introduces a comment
+    CC_SQUOTE, // '\''
+    CC_DQUOTE, // '\"'
+    CC_EOF,    // END_OF_FILE and END_OF_INPUT, never stored in the table
+    CC_COUNT
+} CharClass;
+
+#define OT CC_OTHER
+#define SP CC_SPACE
+#define ZR CC_ZERO
+#define DG CC_DIGIT
+#define HX CC_HEX
+#define EX CC_EXP
+#define XX CC_X
+#define AL CC_ALPHA
+#define US CC_UNDER
+#define DT CC_DOT
+#define SG CC_SIGN
+#define PU CC_PUNCT
+#define SC CC_SEMI
+#define SQ CC_SQUOTE
+#define DQ CC_DQUOTE
+
+static const unsigned char char_class[256] = {
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, SP, SP, SP, SP, SP, OT, OT, // 0x00
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0x10
+    SP, PU, DQ, PU, PU, PU, PU, SQ, PU, PU, PU, SG, PU, SG, DT, PU, // 0x20
+    ZR, DG, DG, DG, DG, DG, DG, DG, DG, DG, PU, SC, PU, PU, PU, PU, // 0x30
+    PU, HX, HX, HX, HX, EX, HX, AL, AL, AL, AL, AL, AL, AL, AL, AL, // 0x40
+    AL, AL, AL, AL, AL, AL, AL, AL, XX, AL, AL, PU, PU, PU, PU, US, // 0x50
+    PU, HX, HX, HX, HX, EX, HX, AL, AL, AL, AL, AL, AL, AL, AL, AL, // 0x60
+    AL, AL, AL, AL, AL, AL, AL, AL, XX, AL, AL, PU, PU, PU, PU, OT, // 0x70
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0x80
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0x90
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0xA0
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0xB0
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0xC0
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0xD0
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0xE0
+    OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, OT, // 0xF0
+};
+
+#undef OT
+#undef SP
+#undef ZR
+#undef DG
+#undef HX
+#undef EX
+#undef XX
+#undef AL
+#undef US
+#undef DT
+#undef SG
+#undef PU
+#undef SC
+#undef SQ
+#undef DQ
+
+// get_char() returns a negative number at the end of the input
+static inline int get_class(int ch) {
+    return (ch < 0) ? CC_EOF : char_class[ch];
+}
+#define CLASS_BIT(c) (1u << get_class(c))
+
+#define IDENT_MASK                                                                   \
+    ((1u << CC_ZERO) | (1u << CC_DIGIT) | (1u << CC_HEX) | (1u << CC_EXP) | (1u << CC_X) | \
+     (1u << CC_ALPHA) | (1u << CC_UNDER))
+#define XDIGIT_MASK ((1u << CC_ZERO) | (1u << CC_DIGIT) | (1u << CC_HEX) | (1u << CC_EXP))
+
+/*
+ * States of the number recognizer. The running states consume the current
+ * character and add it to the token. The final states do not consume the
+ * current character. They finish the token as a literal or as an error.
+ */
+typedef enum {
+    NS_START,   // first digit
+    NS_ZERO,    // a leading '0' has been read
+    NS_INT,     // integer digits
+    NS_MANT,    // '.' and mantissa digits
+    NS_EXP,     // 'e' has been read
+    NS_ESIGN,   // the sign of the exponent has been read
+    NS_EDIGIT,  // exponent digits
+    NS_HEX,     // "0x" and hex digits
+    NS_SIGNED,  // final states start here
+    NS_FLOAT,
+    NS_UNSIGNED,
+    NE_OCTAL,
+    NE_UNKNOWN,
+    NE_INT,
+    NE_MANT,
+    NE_EXP,
+    NE_EXP_TAIL,
+    NE_HEX,
+    NS_COUNT
+} NumState;
+
+#define NS_FINAL NS_SIGNED
+
+#define ZE NS_ZERO
+#define IN NS_INT
+#define MA NS_MANT
+#define EP NS_EXP
+#define ES NS_ESIGN
+#define ED NS_EDIGIT
+#define HE NS_HEX
+#define SI NS_SIGNED
+#define FL NS_FLOAT
+#define UN NS_UNSIGNED
+#define eO NE_OCTAL
+#define eU NE_UNKNOWN
+#define eI NE_INT
+#define eM NE_MANT
+#define eE NE_EXP
+#define eT NE_EXP_TAIL
+#define eH NE_HEX
+
+static const unsigned char number_dfa[NS_FINAL][CC_COUNT] = {
+    //  OT  SP  0   1-9 hex e   x   alp _   .   +-  pun ;   '   "   EOF
+    /* NS_START  */ {eU, eU, ZE, IN, eU, eU, eU, eU, eU, eU, eU, eU, eU, eU, eU, eU},
+    /* NS_ZERO   */ {eU, SI, eO, eO, eU, eU, HE, eU, SI, MA, SI, SI, SI, SI, SI, eU},
+    /* NS_INT    */ {eI, SI, IN, IN, eI, EP, eI, eI, SI, MA, SI, SI, SI, SI, SI, SI},
+    /* NS_MANT   */ {eM, FL, MA, MA, eM, EP, eM, eM, FL, FL, FL, FL, FL, FL, FL, FL},
+    /* NS_EXP    */ {eE, eE, ED, ED, eE, eE, eE, eE, eE, eE, ES, eE, eE, eE, eE, eE},
+    /* NS_ESIGN  */ {eE, eE, ED, ED, eE, eE, eE, eE, eE, eE, eE, eE, eE, eE, eE, eE},
+    /* NS_EDIGIT */ {eT, FL, ED, ED, eT, eT, eT, eT, FL, FL, FL, FL, FL, FL, FL, FL},
+    /* NS_HEX    */ {eH, UN, HE, HE, HE, HE, eH, eH, UN, UN, UN, UN, UN, UN, UN, UN},
+};
+
+#undef ZE
+#undef IN
+#undef MA
+#undef EP
+#undef ES
+#undef ED
+#undef HE
+#undef SI
+#undef FL
+#undef UN
+#undef eO
+#undef eU
+#undef eI
+#undef eM
+#undef eE
+#undef eT
+#undef eH
+
+/*
+ * What to do with the token when the number recognizer reaches a final
+ * state. Errors either append the message to the digits that were read or
+ * replace them.
+ */
+static const struct {
+    TokenType type;
+    bool clear;
+    const char* msg;
+} number_final[NS_COUNT - NS_FINAL] = {
+    [NS_SIGNED - NS_FINAL]   = {TOK_LITERAL_SIGNED, false, NULL},
+    [NS_FLOAT - NS_FINAL]    = {TOK_LITERAL_FLOAT, false, NULL},
+    [NS_UNSIGNED - NS_FINAL] = {TOK_LITERAL_UNSIGNED, false, NULL},
+    [NE_OCTAL - NS_FINAL]    = {TOK_ERROR, false, ": malformed number: octal format not supported"},
+    [NE_UNKNOWN - NS_FINAL]  = {TOK_ERROR, false, ": malformed number: unknown issue"},
+    [NE_INT - NS_FINAL]      = {TOK_ERROR, false, ": malformed number: expected digits, space, or operator"},
+    [NE_MANT - NS_FINAL] = {TOK_ERROR, false, ": malformed number: expected digits, exponent, space, or operator"},
+    [NE_EXP - NS_FINAL]      = {TOK_ERROR, false, ": malformed number: expected digits"},
+    [NE_EXP_TAIL - NS_FINAL] = {TOK_ERROR, false, ": malformed number: expected digits, space, or operator"},
+    [NE_HEX - NS_FINAL] = {TOK_ERROR, true, ": malformed hex number, expected hex digit, space or operator"},
+};
+
+/*
+ * Operators are at most two characters long and the second one is always
+ * a '='. The table gives the token for the single character and for the
+ * character followed by a '='. Since no operator can be TOK_END_OF_FILE,
+ * a zero entry means that the character is not an operator, or that it has
+ * no two character form.
+ */
+static const struct {
+    TokenType single;
+    TokenType with_equal;
+} operator_table[128] = {
+    ['^'] = {TOK_CARAT, 0},
+    ['('] = {TOK_OPAREN, 0},
+    [')'] = {TOK_CPAREN, 0},
+    ['{'] = {TOK_OCBRACE, 0},
+    ['}'] = {TOK_CCBRACE, 0},
+    ['['] = {TOK_OSBRACE, 0},
+    [']'] = {TOK_CSBRACE, 0},
+    ['.'] = {TOK_DOT, 0},
+    [','] = {TOK_COMMA, 0},
+    ['@'] = {TOK_AMPER, 0},
+    [':'] = {TOK_COLON, 0},
+    ['&'] = {TOK_AND, 0},
+    ['|'] = {TOK_OR, 0},
+    ['<'] = {TOK_OPAREN, TOK_LORE},
+    ['>'] = {TOK_CPAREN, TOK_GORE},
+    ['='] = {TOK_ASSIGN, TOK_EQU},
+    ['+'] = {TOK_ADD, TOK_ADD_ASSIGN},
+    ['-'] = {TOK_SUB, TOK_SUB_ASSIGN},
+    ['*'] = {TOK_MUL, TOK_MUL_ASSIGN},
+    ['/'] = {TOK_DIV, TOK_DIV_ASSIGN},
+    ['%'] = {TOK_MOD, TOK_MOD_ASSIGN},
+    ['!'] = {TOK_NOT, TOK_NEQU},
+};
+
 
 /**
  * @brief Comments are not returned by the scanner. This reads from the ';'
@@ -42,416 +267,144 @@ static Token token;
  */
 static void eat_comment(void) {
 
-    int ch;
+    size_t len;
+    const unsigned char* buf = get_input_buffer(&len);
 
-    // the current char is a ';' when this is entered
-    while(true) {
-        ch = consume_char();
-        if(ch == '\n' || ch == '\r' || ch == END_OF_FILE || ch == END_OF_INPUT)
-            break;
-    }
+    // the current char is a ';' when this is entered. Stop on the end of
+    // the line without consuming it.
+    consume_chars(fast_scan.find_eol(buf, len));
 }
 
-/**
- * @brief Scan a number in hex format. When this is called, the 'x' is the
- * current character.
+/*
+ * The character that each escape in a double quote string stands for. A
+ * zero means that the escape is not recognized. The 'x' escape is handled
+ * separately.
  */
-static void scan_unsigned(void) {
+static const unsigned char escape_table[256] = {
+    ['\\'] = '\\', ['n'] = '\n', ['r'] = '\r', ['\''] = '\'', ['\"'] = '\"', ['t'] = '\t',
+    ['f'] = '\f',  ['v'] = '\v', ['a'] = '\a', ['b'] = '\b',   ['e'] = 0x1B,
+};
 
-    int ch = get_char();
-
-    // add the 'x' to the string
-    add_string_char(token.str, ch);
-    ch = consume_char();
+/**
+ * @brief Start a token at the current character.
+ */
+static void start_token(void) {
 
-    while(true) {
-        if(isxdigit(ch)) {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-        }
-        else if(isspace(ch) || ispunct(ch) || ch == EOF)
-            return;
-        else {
-            token.type = TOK_ERROR;
-            clear_string(token.str);
-            add_string_str(token.str, ": malformed hex number, expected hex digit, space or operator");
-            return;
-        }
-    }
+    token.file_id = get_file_id();
+    token.offset  = (unsigned)get_input_offset();
+    token.len     = 0;
+    token.sym     = SYMID_NONE;
+    token.str     = NULL;
 }
 
 /**
- * @brief Scan the exponent of a floating point number. When this is
- * entered, the 'e' has already been seen but not consumed.
+ * @brief The text of the token is everything from the start of the token
+ * to the current character.
  */
-static void scan_exponent(void) {
+static void end_slice(void) {
 
-    // save the 'e'
-    int ch = get_char();
-    add_string_char(token.str, ch);
-    ch = consume_char();
-
-    // check for a sign.
-    if(ch == '+' || ch == '-') {
-        add_string_char(token.str, ch);
-        ch = consume_char();
-    }
-
-    if(isdigit(ch)) {
-        do {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-        } while(isdigit(ch));
-
-        // when we run out of digits we are done if ending on white space
-        // or an operator. Otherwise, it's an error.
-        if(isspace(ch) || ispunct(ch) || ch == EOF)
-            token.type = TOK_LITERAL_FLOAT;
-        else {
-            token.type = TOK_ERROR;
-            add_string_str(token.str, ": malformed number: expected digits, space, or operator");
-        }
-    }
-    else {
-        token.type = TOK_ERROR;
-        add_string_str(token.str, ": malformed number: expected digits");
-    }
+    token.len = (unsigned)get_input_offset() - token.offset;
 }
 
 /**
- * @brief Scan the mantissa of a floating point number. When this is
- * entered, the '.' has been seen but not consumed.
+ * @brief Errors carry a message instead of the source text, so the text is
+ * created right away. The message is added to the part of the token that was
+ * already scanned, unless the text is cleared.
+ *
+ * @param keep is the number of characters of the token to keep
+ * @param fmt
  */
-static void scan_mantissa(void) {
+static void error_token(unsigned keep, const char* fmt, ...) {
 
-    int ch = get_char();
-    add_string_char(token.str, ch);
-    ch = consume_char();
+    va_list args;
 
-    while(isdigit(ch)) {
-        add_string_char(token.str, ch);
-        ch = consume_char();
-    }
+    token.type = TOK_ERROR;
+    token.str  = create_string(NULL);
+    if(keep > 0)
+        add_string_buf(token.str, (const char*)get_source_text(token.file_id) + token.offset, (int)keep);
 
-    if(ch == 'e' || ch == 'E') {
-        scan_exponent();
-    }
-    else if(isspace(ch) || ispunct(ch) || ch == EOF) {
-        // no exponent. finished.
-        token.type = TOK_LITERAL_FLOAT;
-    }
-    else {
-        token.type = TOK_ERROR;
-        add_string_str(token.str, ": malformed number: expected digits, exponent, space, or operator");
-    }
+    va_start(args, fmt);
+    size_t len = vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+
+    char* buf = _ALLOC(len + 1);
+    va_start(args, fmt);
+    vsnprintf(buf, len + 1, fmt, args);
+    va_end(args);
+
+    add_string_str(token.str, buf);
+    _FREE(buf);
 }
 
 /**
  * @brief All numbers in Kata are floating point with an optional
  * mantissa and exponent. Any string that strtod() recognizes is valid. If
  * the first character is a '0' then it must be followed by a '.' or a
- * non-digit. Leading '0' in a number is a syntax error.
+ * non-digit. Leading '0' in a number is a syntax error. A "0x" introduces
+ * an unsigned hex number. The number is recognized by running the state
+ * machine in number_dfa[] until it reaches a final state. The character
+ * that caused the final state is not consumed.
  */
 static void scan_number(void) {
 
-    int ch = get_char();
+    int ch    = get_char();
+    int state = NS_START;
+
+    while(true) {
+        state = number_dfa[state][get_class(ch)];
+        if(state >= NS_FINAL)
+            break;
 
-    if(ch == '0') {
-        // if the leading character is a zero
         ch = consume_char();
-        add_string_char(token.str, '0');
-
-        switch(ch) {
-            case '.':
-                // has the format of "0.xxx"
-                // do not consume the dot.
-                token.type = TOK_LITERAL_FLOAT;
-                scan_mantissa();
-                return;
-            case 'x':
-            case 'X':
-                // scan for a hex number
-                // do not consume the 'x'
-                token.type = TOK_LITERAL_UNSIGNED;
-                scan_unsigned();
-                return;
-            default:
-                if(isspace(ch) || ispunct(ch)) {
-                    // single zero with no other chars
-                    token.type = TOK_LITERAL_SIGNED;
-                    return;
-                }
-                else if(isdigit(ch)) {
-                    token.type = TOK_ERROR;
-                    add_string_str(token.str, ": malformed number: octal format not supported");
-                    return;
-                }
-                // this should never happen
-                token.type = TOK_ERROR;
-                add_string_str(token.str, ": malformed number: unknown issue");
-                return;
-        }
-    }
-    else {
-        // the first character was not a zero.
-        bool finished = false;
-
-        while(!finished) {
-            ch = get_char();
-            switch(ch) {
-                case 'e':
-                case 'E':
-                    scan_exponent();
-                    finished = true;
-                    break;
-                case '.':
-                    scan_mantissa();
-                    finished = true;
-                    break;
-                default:
-                    if(isdigit(ch)) {
-                        add_string_char(token.str, ch);
-                        consume_char();
-                    }
-                    else if(isspace(ch) || ispunct(ch) || ch == EOF) {
-                        token.type = TOK_LITERAL_SIGNED;
-                        finished   = true;
-                    }
-                    else {
-                        token.type = TOK_ERROR;
-                        add_string_str(token.str, ": malformed number: expected digits, space, or operator");
-                    }
-            }
-        }
     }
+
+    end_slice();
+    if(number_final[state - NS_FINAL].msg != NULL)
+        error_token(number_final[state - NS_FINAL].clear ? 0 : token.len, "%s",
+                    number_final[state - NS_FINAL].msg);
+    else
+        token.type = number_final[state - NS_FINAL].type;
 }
 
 /**
  * @brief Single and multi-character operators as defined in the grammar.
+ * Characters that are punctuation but not operators are returned as an
+ * error token.
  */
 static void scan_operator(void) {
 
-    int ch = get_char();
-
     // when this is entered, the current char is the first char of the operator
-    switch(ch) {
-        // single character operators
-        case '^':
-            token.type = TOK_CARAT;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '(':
-            token.type = TOK_OPAREN;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case ')':
-            token.type = TOK_CPAREN;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '{':
-            token.type = TOK_OCBRACE;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '}':
-            token.type = TOK_CCBRACE;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '[':
-            token.type = TOK_OSBRACE;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case ']':
-            token.type = TOK_CSBRACE;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '.':
-            token.type = TOK_DOT;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case ',':
-            token.type = TOK_COMMA;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '@':
-            token.type = TOK_AMPER;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case ':':
-            token.type = TOK_COLON;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '&':
-            token.type = TOK_AND;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
-        case '|':
-            token.type = TOK_OR;
-            add_string_char(token.str, ch);
-            consume_char();
-            return;
+    int first = get_char();
 
-        // multi-character operators
-        case '<': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_LORE;
-            }
-            else
-                token.type = TOK_OPAREN;
-        }
-            return;
-        case '>': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_GORE;
-            }
-            else
-                token.type = TOK_CPAREN;
-        }
-            return;
-        case '=': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_EQU;
-            }
-            else
-                token.type = TOK_ASSIGN;
-        }
-            return;
-        case '+': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_ADD_ASSIGN;
-            }
-            else
-                token.type = TOK_ADD;
-        }
-            return;
-        case '-': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_SUB_ASSIGN;
-            }
-            else
-                token.type = TOK_SUB;
-        }
-            return;
-        case '*': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_MUL_ASSIGN;
-            }
-            else
-                token.type = TOK_MUL;
-        }
-            return;
-        case '/': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_DIV_ASSIGN;
-            }
-            else
-                token.type = TOK_DIV;
-        }
-            return;
-        case '%': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_MOD_ASSIGN;
-            }
-            else
-                token.type = TOK_MOD;
-        }
-            return;
-        case '!': {
-            add_string_char(token.str, ch);
-            ch = consume_char();
-            if(ch == '=') {
-                add_string_char(token.str, ch);
-                consume_char();
-                token.type = TOK_NEQU;
-            }
-            else
-                token.type = TOK_NOT;
-        }
-            return;
+    if(operator_table[first].single == 0) {
+        consume_char();
+        error_token(1, ": unexpected character");
+        return;
+    }
+
+    int ch = consume_char();
+    if(ch == '=' && operator_table[first].with_equal != 0) {
+        consume_char();
+        token.type = operator_table[first].with_equal;
     }
+    else
+        token.type = operator_table[first].single;
+
+    end_slice();
 }
 
 /**
- * @brief Check to see if the word is a keyword using a binary search of
- * the keyword list that is generated by the parser generator. Note that
- * the keyword list is sorted by the parser generator.
+ * @brief Check to see if the word is a keyword using the perfect hash that
+ * is generated with the keyword list. If the word is not a keyword, then it
+ * is a SYMBOL and its name is interned. Keywords are not case-sensitive.
  */
 static void check_keyword(void) {
 
-    const char* s = raw_string(token.str);
-    int l = 0, r = num_keywords - 1, m, x;
+    const char* text = (const char*)get_source_text(token.file_id) + token.offset;
 
-    // setup the token. If the string is not found, then this is not changed.
-    token.type = TOK_SYMBOL;
-
-    // the loop will run till there are elements in the
-    // sub-array as l > r means that there are no elements to
-    // consider in the given sub-array
-    while(l <= r) {
-        // calculating mid point
-        m = l + (r - l) / 2;
-        // see how the string compares.
-        x = strcasecmp(keyword_list[m].str, s);
-
-        // Check if x is present at mid
-        if(x == 0) {
-            token.type = keyword_list[m].type;
-            break;
-        }
-        // If x greater than zero ignore left half
-        if(x < 0) {
-            l = m + 1;
-        }
-        // If x is smaller than m, ignore right half
-        else {
-            r = m - 1;
-        }
-    }
-    // if we reach here, then element was not present so return it as
-    // a SYMBOL.
+    token.type = find_keyword(text, (int)token.len);
+    if(token.type == TOK_SYMBOL)
+        token.sym = intern_buf(text, token.len);
 }
 
 /**
@@ -465,26 +418,29 @@ static void check_keyword(void) {
  */
 static void scan_inline_block(void) {
 
+    // the keyword is the text of the token until the block is found
+    unsigned word = token.len;
+
     // skip white space
-    while(isspace(consume_char()))
+    while(get_class(consume_char()) == CC_SPACE)
         ;
 
     // get the opening '{'
     if(get_char() != '{') {
         // Do not consume the character in the presumption that the the
         // error handler will want to know what it was.
-        token.type = TOK_ERROR;
-        add_string_str(token.str, ": expected a '{' to introduce the block");
+        error_token(word, ": expected a '{' to introduce the block");
         return;
     }
 
     int count = 1;
     int ch;
 
-    clear_string(token.str);
     // consume the opening '{'
     consume_char();
-    // copy the characters
+    token.offset = (unsigned)get_input_offset();
+
+    // find the end of the text
     while(true) {
         ch = get_char();
         if(ch == '{') {
@@ -495,10 +451,10 @@ static void scan_inline_block(void) {
         }
 
         if(count > 0 && ch != EOF) {
-            add_string_char(token.str, ch);
             consume_char();
         }
         else {
+            end_slice();
             consume_char();
             break;
         }
@@ -514,20 +470,14 @@ static void scan_inline_block(void) {
  */
 static void scan_word(void) {
 
-    int ch;
-
     // current char is the first letter of the word when this is entered
-    while(true) {
-        ch = get_char();
-        if(isalnum(ch) || ch == '_') {
-            add_string_char(token.str, ch);
-            consume_char();
-        }
-        else
-            break;
-    }
+    int ch = get_char();
+
+    while(CLASS_BIT(ch) & IDENT_MASK)
+        ch = consume_char();
 
     // look for a keyword, or else a SYMBOL
+    end_slice();
     check_keyword();
 
     // This scanner supports an "inline" keyword as a separate entity. When
@@ -546,209 +496,199 @@ static void scan_word(void) {
  */
 static void scan_squote_str(void) {
 
-    int ch;
-    bool finished = false;
-
     consume_char(); // consume the '\''
-    while(!finished) {
-        ch = get_char();
-        if(ch == '\'') {
-            token.type = TOK_LITERAL_SSTR;
-            consume_char();
-            finished = true;
-        }
-        else if(ch == EOF) {
-            token.type = TOK_ERROR;
-            // the string could be very long, so clear it before returning.
-            clear_string(token.str);
-            add_string_str(token.str, "invalid string. Unexpected end of file.");
-            finished = true;
-        }
-        else {
-            add_string_char(token.str, ch);
-            consume_char();
-        }
+    token.offset = (unsigned)get_input_offset();
+
+    // find the closing quote in one shot
+    size_t len;
+    const unsigned char* buf = get_input_buffer(&len);
+    size_t run               = fast_scan.find_squote(buf, len);
+    consume_chars(run);
+
+    if(get_char() == '\'') {
+        token.type = TOK_LITERAL_SSTR;
+        end_slice();
+        consume_char();
     }
+    else
+        error_token(0, "invalid string. Unexpected end of file.");
 }
 
 /**
  * @brief Scan a double quote string. Double quote strings support escape
  * characters using a backslash. The string is returned as a LITERAL_STR
- * without the quotes. All of the escape characters are translated and
- * inserted into the string.
+ * without the quotes. The escapes are checked here, but they are only
+ * translated when the text of the token is needed. See expand_dquote_str().
  */
 static void scan_dquote_str(void) {
 
-    int ch        = consume_char(); // consume the '\"'
-    bool finished = false;
+    consume_char(); // consume the '\"'
+    token.offset = (unsigned)get_input_offset();
 
-    while(!finished) {
-        ch = get_char();
+    while(true) {
+        // skip everything up to the closing quote or the next escape
+        size_t len;
+        const unsigned char* buf = get_input_buffer(&len);
+        consume_chars(fast_scan.find_dquote(buf, len));
+
+        int ch = get_char();
         if(ch == '\"') {
-            finished   = true;
             token.type = TOK_LITERAL_DSTR;
+            end_slice();
             consume_char();
+            return;
         }
         else if(ch == '\\') {
             ch = consume_char();
-            switch(ch) {
-                case '\\':
-                    add_string_char(token.str, '\\');
-                    consume_char();
-                    break;
-                case 'n':
-                    add_string_char(token.str, '\n');
-                    consume_char();
-                    break;
-                case 'r':
-                    add_string_char(token.str, '\r');
-                    consume_char();
-                    break;
-                case '\'':
-                    add_string_char(token.str, '\'');
-                    consume_char();
-                    break;
-                case '\"':
-                    add_string_char(token.str, '\"');
-                    consume_char();
-                    break;
-                case 't':
-                    add_string_char(token.str, '\t');
-                    consume_char();
-                    break;
-                case 'f':
-                    add_string_char(token.str, '\f');
-                    consume_char();
-                    break;
-                case 'v':
-                    add_string_char(token.str, '\v');
-                    consume_char();
-                    break;
-                case 'a':
-                    add_string_char(token.str, '\a');
-                    consume_char();
-                    break;
-                case 'b':
-                    add_string_char(token.str, '\b');
-                    consume_char();
-                    break;
-                case 'e':
-                    add_string_char(token.str, 0x1B);
-                    consume_char();
-                    break;
-                case 'x': { // the next 2 characters must be hex digits
-                    char buf[5] = "0x";
-                    buf[2]      = consume_char();
-                    buf[3]      = consume_char();
-                    buf[4]      = 0;
-                    if(isxdigit(buf[2]) && isxdigit(buf[3])) {
-                        add_string_char(token.str, (int)strtol(buf, NULL, 16));
-                    }
-                    else {
-                        // syntax error
-                        token.type = TOK_ERROR;
-                        clear_string(token.str);
-                        add_string_fmt(token.str, "invalid string. expected a hex number but got \\x%c%c",
-                                       buf[2], buf[3]);
-                        finished = true;
-                    }
-                } break;
-                default: // just store the next character, whatever it is
-                    add_string_char(token.str, ch);
-                    break;
+            if(ch == 'x') { // the next 2 characters must be hex digits
+                int h1 = consume_char();
+                int h2 = consume_char();
+                if(!((CLASS_BIT(h1) & XDIGIT_MASK) && (CLASS_BIT(h2) & XDIGIT_MASK))) {
+                    // syntax error
+                    error_token(0, "invalid string. expected a hex number but got \\x%c%c", (char)h1,
+                                (char)h2);
+                    return;
+                }
+                // the second digit is also taken as a normal character
             }
-        }
-        else if(ch == EOF) {
-            token.type = TOK_ERROR;
-            // the string could be very long, so clear it before returning.
-            clear_string(token.str);
-            add_string_str(token.str, "invalid string. Unexpected end of file.");
-            finished = true;
+            else if(ch >= 0 && escape_table[ch] != 0)
+                consume_char();
+            // else the next character is taken as a normal character
         }
         else {
-            add_string_char(token.str, ch);
-            consume_char();
+            // end of file
+            error_token(0, "invalid string. Unexpected end of file.");
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Translate the escapes in the body of a double quote string. This
+ * follows the same rules as scan_dquote_str(), which has already checked
+ * that all of the escapes are valid.
+ *
+ * @param buf
+ * @param len
+ * @return String*
+ */
+static String* expand_dquote_str(const unsigned char* buf, size_t len) {
+
+    String* str = create_string(NULL);
+    size_t idx  = 0;
+
+    while(idx < len) {
+        size_t run = fast_scan.find_dquote(&buf[idx], len - idx);
+        add_string_buf(str, (const char*)&buf[idx], (int)run);
+        idx += run;
+
+        if(idx < len) {
+            // buf[idx] is a '\\' and the string cannot end with it.
+            int ch = buf[++idx];
+            if(ch == 'x') {
+                char hex[5] = {'0', 'x', (char)buf[idx + 1], (char)buf[idx + 2], 0};
+                add_string_char(str, (int)strtol(hex, NULL, 16));
+                // leave the second digit as the current character
+                idx += 2;
+            }
+            else if(escape_table[ch] != 0) {
+                add_string_char(str, escape_table[ch]);
+                idx++;
+            }
+            else
+                // store the next character, whatever it is, and then take
+                // it again as a normal character
+                add_string_char(str, ch);
         }
     }
+
+    return str;
 }
 
 /**
- * @brief Mark the token with the file name and the line number.
+ * @brief Mark the token with the line number.
  */
 static void finish_token(void) {
 
     token.line_no = get_line_no();
     token.col_no  = get_col_no();
-    const char* s = get_fname();
-    if(s != NULL) {
-        const char* tmp = strrchr(s, '/');
-        if(tmp)
-            token.fname = _DUP_STR(tmp + 1);
-        else
-            token.fname = _DUP_STR(s);
-    }
-    else
-        token.fname = _DUP_STR("no open file");
 }
 
 /**
  * @brief This function reads a token from the input stream and returns in
- * in a pointer to a global static Token data structure. When the token is
- * read, a deep copy is performed to preserve the value. This keeps us from
- * having to recompose the data structure every time a token is read.
+ * in a pointer to a global static Token data structure. The token refers
+ * to its text in the source buffer, so nothing is copied unless the token
+ * is an error.
  */
 Token* scan_token(void) {
 
     bool finished = false;
     int ch;
 
-    clear_string(token.str);
     while(!finished) {
         ch = get_char();
-
-        // skip whitespace. line counting is done elsewhere
-        if(isspace(ch)) {
-            consume_char();
-            continue;
-        }
-        // comment precursor
-        else if(ch == ';') {
-            eat_comment();
-        }
-        // single quote strings are absolute literals
-        else if(ch == '\'') {
-            scan_squote_str();
-            finished = true;
-        }
-        // double quote strings can have escape characters
-        else if(ch == '\"') {
-            scan_dquote_str();
-            finished = true;
-        }
-        // scan a number and return it
-        else if(isdigit(ch)) {
-            scan_number();
-            finished = true;
-        }
-        // symbols and keywords start with a letter
-        else if(isalpha(ch) || ch == '_') {
-            scan_word();
-            finished = true;
-        }
-        // scan an operator and return it
-        else if(ispunct(ch)) {
-            scan_operator();
-            finished = true;
-        }
-        // end of input has been reached where there are no more files in
-        // the file stack.
-        else if(ch == END_OF_FILE) {
-            token.type = TOK_END_OF_FILE;
-            finished   = true;
-        }
-        else if(ch == END_OF_INPUT) {
-            token.type = TOK_END_OF_INPUT;
-            finished   = true;
+        start_token();
+
+        switch(get_class(ch)) {
+            // skip whitespace. line counting is done elsewhere
+            case CC_SPACE: {
+                // most white space is a single character between tokens,
+                // so only search when there is a run of it.
+                size_t len;
+                const unsigned char* buf = get_input_buffer(&len);
+                if(len > 1 && get_class(buf[1]) == CC_SPACE)
+                    consume_chars(fast_scan.skip_space(buf, len));
+                else
+                    consume_char();
+            } break;
+            // comment precursor
+            case CC_SEMI:
+                eat_comment();
+                break;
+            // single quote strings are absolute literals
+            case CC_SQUOTE:
+                scan_squote_str();
+                finished = true;
+                break;
+            // double quote strings can have escape characters
+            case CC_DQUOTE:
+                scan_dquote_str();
+                finished = true;
+                break;
+            // scan a number and return it
+            case CC_ZERO:
+            case CC_DIGIT:
+                scan_number();
+                finished = true;
+                break;
+            // symbols and keywords start with a letter
+            case CC_HEX:
+            case CC_EXP:
+            case CC_X:
+            case CC_ALPHA:
+            case CC_UNDER:
+                scan_word();
+                finished = true;
+                break;
+            // scan an operator and return it
+            case CC_DOT:
+            case CC_SIGN:
+            case CC_PUNCT:
+                scan_operator();
+                finished = true;
+                break;
+            // end of input has been reached where there are no more files in
+            // the file stack.
+            case CC_EOF:
+                token.type = (ch == END_OF_INPUT) ? TOK_END_OF_INPUT : TOK_END_OF_FILE;
+                finished   = true;
+                break;
+            // anything else cannot appear outside of a comment or a string
+            default:
+                consume_char();
+                error_token(0, "0x%02X: unexpected character", ch);
+                finished = true;
+                break;
         }
     }
 
@@ -764,7 +704,7 @@ void init_scanner(const char* fname) {
 
     ENTER;
     memset(&token, 0, sizeof(Token));
-    token.str = create_string(NULL);
+    init_fastscan();
 
     open_file(fname);
     append_token(scan_token());
@@ -784,3 +724,68 @@ TokenType token_type(Token* tok) {
     assert(tok != NULL);
     return tok->type;
 }
+
+/**
+ * @brief Return the text of the token. The text is created from the source
+ * the first time that it is asked for and kept with the token after that.
+ * Tokens that do not have any text, such as the end of file, return an
+ * empty string.
+ *
+ * @param tok
+ * @return String*
+ */
+String* token_str(Token* tok) {
+
+    assert(tok != NULL);
+
+    if(tok->str == NULL) {
+        if(tok->file_id < 0 || tok->len == 0)
+            tok->str = create_string(NULL);
+        else {
+            const unsigned char* buf = get_source_text(tok->file_id) + tok->offset;
+            if(tok->type == TOK_LITERAL_DSTR)
+                tok->str = expand_dquote_str(buf, tok->len);
+            else {
+                tok->str = create_string(NULL);
+                add_string_buf(tok->str, (const char*)buf, (int)tok->len);
+            }
+        }
+    }
+
+    return tok->str;
+}
+
+/**
+ * @brief Return the text of the token as a C string. The text of a SYMBOL
+ * is the canonical interned copy, so nothing is allocated for it.
+ *
+ * @param tok
+ * @return const char*
+ */
+const char* token_text(Token* tok) {
+
+    if(tok->sym != SYMID_NONE)
+        return interned_str(tok->sym);
+
+    return raw_string(token_str(tok));
+}
+
+/**
+ * @brief Return the name of the file that the token came from without the
+ * path.
+ *
+ * @param tok
+ * @return const char*
+ */
+const char* token_fname(Token* tok) {
+
+    assert(tok != NULL);
+
+    if(tok->file_id < 0)
+        return "no open file";
+
+    const char* s   = get_source_name(tok->file_id);
+    const char* tmp = strrchr(s, '/');
+
+    return (tmp != NULL) ? tmp + 1 : s;
+}
@@ -13,6 +13,8 @@
 #ifndef __SCANNER_H__
 #define __SCANNER_H__
 
+#include <stddef.h>
+
 //#include "util.h"
 
 /*
@@ -21,7 +23,22 @@
  */
 #include "tokens.h"
 
-#define TTYPE (token_type(get_token()))
+#define TTYPE (get_token_type())
+
+/*
+ * A position in the token queue that can be returned to with
+ * reset_token_queue().
+ */
+typedef int TokPost;
+
+/*
+ * Counts of what the token queue has done, for the parser statistics.
+ */
+typedef struct {
+    unsigned long scanned; // tokens read from the scanner
+    unsigned long resets;  // calls to reset_token_queue()
+    unsigned long rewound; // tokens that the resets moved back over
+} TokQueueStats;
 
 /**
  * @brief Open a file for the scanner to read from. Files are expected to be
@@ -32,20 +49,39 @@
  */
 void open_file(const char* fname);
 
+/**
+ * @brief Open part of a source file that was read before, so that it can
+ * be parsed again. The scanner sees the end of the file at end.
+ *
+ * @param id
+ * @param pos
+ * @param end
+ * @param line_no
+ * @param col_no
+ */
+void open_source_range(int id, size_t pos, size_t end, int line_no, int col_no);
+
 /**
  * @brief Close the current file and pop it off of the file stack.
  */
 void close_file(void);
 
 /**
- * @brief Get the token object. This returns the current token, which is a
- * global in the scanner. If the pointer to this token needs to be referenced,
- * after advance_token() is called, then the token should be copied.
+ * @brief Get the token object. This returns a pointer to the current token
+ * that stays valid after advance_token() is called, so it can be stored.
  *
  * @return Token*
  */
 Token* get_token(void);
 
+/**
+ * @brief Return the type of the current token. This is what the parser uses
+ * to match rules and it does not create a token pointer.
+ *
+ * @return TokenType
+ */
+TokenType get_token_type(void);
+
 /**
  * @brief Return the token type.
  *
@@ -56,18 +92,46 @@ Token* get_token(void);
 TokenType token_type(Token* tok);
 
 /**
- * @brief Do a deep copy of the given token pointer. All memory is duplicated.
+ * @brief Copy the given token pointer. The text of the token is shared.
  *
  * @param tok
  * @return Token*
  */
 Token* copy_token(const Token* tok);
 
+/**
+ * @brief Return the text of the token. Tokens refer to their text in the
+ * source file and it is only copied into a string when it is asked for.
+ * Escapes in double quote strings are translated at that time.
+ *
+ * @param tok
+ * @return String*
+ */
+String* token_str(Token* tok);
+
+/**
+ * @brief Return the text of the token as a C string. See token_str().
+ *
+ * @param tok
+ * @return const char*
+ */
+const char* token_text(Token* tok);
+
+/**
+ * @brief Return the name of the file that the token was taken from, without
+ * the path.
+ *
+ * @param tok
+ * @return const char*
+ */
+const char* token_fname(Token* tok);
+
 /**
  * @brief Make the next token in the stream the current token. This could
  * return a token that has already been read if the queue was reset, or a
  * new token could be read, depending on the state of the queue as set by
- * the other functions.
+ * the other functions. The returned pointer is only good until the queue
+ * is advanced again. Use get_token() for a pointer that can be kept.
  *
  * @return Token*
  */
@@ -94,18 +158,33 @@ void finalize_token_queue(void);
  * recovery function needs to know which tokens are involved in the error and
  * that data is captured by the flags this function undoes.
  *
- * @param tok
+ * @param post
  */
-void reset_token_queue(void* crnt);
+void reset_token_queue(TokPost post);
 
 /**
- * @brief Grab the current queue pointer so that it can be reset when the
- * crnt pointer moves as a result of parsing the line. This is used in
+ * @brief Grab the current queue position so that it can be reset when the
+ * current token moves as a result of parsing the line. This is used in
  * conjunction with reset_token_queue().
  *
- * @return void*
+ * @return TokPost
+ */
+TokPost post_token_queue(void);
+
+/**
+ * @brief Return a number that identifies the current token queue. Posts
+ * are only meaningful in the queue that they were taken from.
+ *
+ * @return int
+ */
+int token_queue_id(void);
+
+/**
+ * @brief Return the counts of the token queue for the whole compile.
+ *
+ * @return const TokQueueStats*
  */
-void* post_token_queue(void);
+const TokQueueStats* get_token_queue_stats(void);
 
 /**
  * @brief Iterate the token queue. This is used by consumers that require
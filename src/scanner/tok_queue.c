@@ -22,23 +22,100 @@
 #include "trace.h"
 
 extern Token* scan_token(void);
-static unsigned serial = 0;
-
-typedef struct _tok_queue_item_ {
-    Token* tok;      // the actual token pointer.
-    unsigned serial; // serial number of the token.
-    bool used;       // When the token has been finalized in a rule.
-    struct _tok_queue_item_* next;
-} TokQueueItem;
 
+/*
+ * The queue is a set of parallel ring buffers that grow together. The
+ * parser looks at the type of the current token far more often than
+ * anything else, so the types are kept in their own dense array. The rest
+ * of the token is kept by value in the slot array. A Token pointer is only
+ * created for a slot when the parser asks for one with get_token() and that
+ * pointer is kept with the slot, so every request for the same token
+ * returns the same pointer. The pointer belongs to the caller after that.
+ *
+ * Positions in the queue count up from the start of the file, so a post is
+ * an integer and resetting the queue is an assignment. The slot for a
+ * position is the position masked by the size of the ring. When a rule is
+ * finalized, the slots before the current token are given back to the ring
+ * so the number of slots in use is the distance that the parser can back
+ * up, not the number of tokens in the file.
+ */
 typedef struct {
-    TokQueueItem* head;
-    TokQueueItem* crnt;
-    TokQueueItem* tail;
+    TokenType* type; // type of every token in the queue
+    Token* slot;     // the token data, by value
+    Token** handle;  // pointer given out by get_token(), or NULL
+    TokPost head;    // first token that is not finalized
+    TokPost crnt;    // the current token
+    TokPost tail;    // one past the last token that was scanned
+    int mask;        // number of slots allocated less one
+    int id;          // unique for every queue that is created
 } TokQueue;
 
 // static TokQueue* tqueue = NULL;
-static LinkList* tqueue_stack = NULL;
+static _Thread_local LinkList* tqueue_stack = NULL;
+static _Thread_local int queue_serial       = 0;
+static _Thread_local TokQueueStats queue_stats;
+
+/**
+ * @brief Double the size of the ring. The tokens that are still live are
+ * copied to their slots in the new ring.
+ *
+ * @param tqueue
+ */
+static void grow_token_queue(TokQueue* tqueue) {
+
+    int cap         = (tqueue->type == NULL) ? 0x01 << 8 : (tqueue->mask + 1) << 1;
+    TokenType* type = _ALLOC_ARRAY(TokenType, cap);
+    Token* slot     = _ALLOC_ARRAY(Token, cap);
+    Token** handle  = _ALLOC_ARRAY(Token*, cap);
+
+    for(TokPost pos = tqueue->head; pos < tqueue->tail; pos++) {
+        int from                = pos & tqueue->mask;
+        type[pos & (cap - 1)]   = tqueue->type[from];
+        slot[pos & (cap - 1)]   = tqueue->slot[from];
+        handle[pos & (cap - 1)] = tqueue->handle[from];
+    }
+
+    if(tqueue->type != NULL) {
+        _FREE(tqueue->type);
+        _FREE(tqueue->slot);
+        _FREE(tqueue->handle);
+    }
+
+    tqueue->type   = type;
+    tqueue->slot   = slot;
+    tqueue->handle = handle;
+    tqueue->mask   = cap - 1;
+}
+
+/**
+ * @brief Give the slots of the tokens before the position back to the
+ * ring. A string that was created by the scanner is only destroyed if
+ * nobody took a pointer to the token.
+ *
+ * @param tqueue
+ * @param pos
+ */
+static void release_token_queue(TokQueue* tqueue, TokPost pos) {
+
+    for(; tqueue->head < pos; tqueue->head++) {
+        int idx = tqueue->head & tqueue->mask;
+        if(tqueue->handle[idx] == NULL && tqueue->slot[idx].str != NULL)
+            destroy_string(tqueue->slot[idx].str);
+        tqueue->handle[idx] = NULL;
+    }
+}
+
+/**
+ * @brief Return the current queue.
+ *
+ * @return TokQueue*
+ */
+static inline TokQueue* crnt_token_queue(void) {
+
+    TokQueue* tqueue = peek_link_list(tqueue_stack);
+    assert(tqueue != NULL);
+    return tqueue;
+}
 
 /**
  * @brief Push the token queue.
@@ -48,6 +125,7 @@ static LinkList* tqueue_stack = NULL;
 void push_token_queue(void) {
 
     TokQueue* queue = _ALLOC_T(TokQueue);
+    queue->id       = queue_serial++;
     push_link_list(tqueue_stack, queue);
     append_token(scan_token());
 }
@@ -59,7 +137,15 @@ void push_token_queue(void) {
  */
 void pop_token_queue(void) {
 
-    pop_link_list(tqueue_stack);
+    TokQueue* tqueue = pop_link_list(tqueue_stack);
+
+    if(tqueue != NULL) {
+        release_token_queue(tqueue, tqueue->tail);
+        _FREE(tqueue->type);
+        _FREE(tqueue->slot);
+        _FREE(tqueue->handle);
+        _FREE(tqueue);
+    }
 }
 
 /*
@@ -68,26 +154,17 @@ void pop_token_queue(void) {
  */
 void append_token(Token* tok) {
 
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    assert(tqueue != NULL);
+    TokQueue* tqueue = crnt_token_queue();
     assert(tok != NULL);
 
-    TokQueueItem* item;
-
-    item         = _ALLOC_T(TokQueueItem);
-    item->tok    = copy_token(tok);
-    item->serial = serial++;
-    item->used   = false;
+    if(tqueue->type == NULL || tqueue->tail - tqueue->head > tqueue->mask)
+        grow_token_queue(tqueue);
 
-    if(tqueue->tail != NULL) {
-        tqueue->tail->next = item;
-        tqueue->tail       = item;
-    }
-    else {
-        tqueue->head = item;
-        tqueue->crnt = item;
-        tqueue->tail = item;
-    }
+    int idx             = tqueue->tail++ & tqueue->mask;
+    tqueue->type[idx]   = tok->type;
+    tqueue->slot[idx]   = *tok;
+    tqueue->handle[idx] = NULL;
+    queue_stats.scanned++;
 }
 
 /**
@@ -110,6 +187,29 @@ void open_file(const char* fname) {
     RET;
 }
 
+/**
+ * @brief Open part of a source file that was read before, with a queue of
+ * its own. It is closed with close_file() like any other file.
+ *
+ * @param id
+ * @param pos
+ * @param end
+ * @param line_no
+ * @param col_no
+ */
+void open_source_range(int id, size_t pos, size_t end, int line_no, int col_no) {
+
+    ENTER;
+
+    if(tqueue_stack == NULL)
+        tqueue_stack = create_link_list();
+
+    push_input_range(id, pos, end, line_no, col_no);
+    push_token_queue();
+
+    RET;
+}
+
 /**
  * @brief Close the current file and pop it off of the file stack.
  */
@@ -117,32 +217,57 @@ void close_file(void) {
 
     ENTER;
     pop_input_file();
-    pop_link_list(tqueue_stack);
+    pop_token_queue();
     RET;
 }
 
 /**
- * @brief Get the token object. This returns the current token, which is a
- * global in the scanner. If the value of this token needs to be preserved,
- * then the token should be copied.
+ * @brief Get the token object. This returns a pointer to the current token.
+ * The pointer stays valid for the rest of the compile, so it can be kept in
+ * the AST.
  *
  * @return Token*
  */
 Token* get_token(void) {
 
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    assert(tqueue != NULL);
+    TokQueue* tqueue = crnt_token_queue();
+    int idx          = tqueue->crnt & tqueue->mask;
 
-    if(tqueue->crnt != NULL) {
-        return tqueue->crnt->tok;
-    }
+    assert(tqueue->crnt >= tqueue->head && tqueue->crnt < tqueue->tail);
 
-    // Should never happen. Will probably cause a segfault.
-    return NULL;
+    if(tqueue->handle[idx] == NULL)
+        tqueue->handle[idx] = copy_token(&tqueue->slot[idx]);
+
+    return tqueue->handle[idx];
+}
+
+/**
+ * @brief Return the type of the current token without creating a pointer
+ * to it.
+ *
+ * @return TokenType
+ */
+TokenType get_token_type(void) {
+
+    TokQueue* tqueue = crnt_token_queue();
+    return tqueue->type[tqueue->crnt & tqueue->mask];
 }
 
 /**
- * @brief Do a deep copy of the given token pointer. All memory is duplicated.
+ * @brief Return a number that is different for every queue, so that a
+ * position can be matched with the file that it belongs to.
+ *
+ * @return int
+ */
+int token_queue_id(void) {
+
+    return crnt_token_queue()->id;
+}
+
+/**
+ * @brief Copy the given token. The text of the token is in the source
+ * buffer, or in a string that is never changed after it is created, so it
+ * is shared with the copy.
  *
  * @param tok
  * @return Token*
@@ -151,14 +276,8 @@ Token* copy_token(const Token* tok) {
 
     assert(tok != NULL);
 
-    Token* ntok;
-
-    ntok          = _ALLOC_T(Token);
-    ntok->fname   = _DUP_STR(tok->fname);
-    ntok->str     = copy_string(tok->str);
-    ntok->line_no = tok->line_no;
-    ntok->col_no  = tok->col_no;
-    ntok->type    = tok->type;
+    Token* ntok = _ARENA_ALLOC_T(Token);
+    *ntok       = *tok;
 
     return ntok;
 }
@@ -174,32 +293,30 @@ Token* copy_token(const Token* tok) {
 Token* advance_token(void) {
 
     ENTER;
-    // avoid stupid programmer tricks
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    assert(tqueue != NULL);
-    assert(tqueue->crnt != NULL);
+    TokQueue* tqueue = crnt_token_queue();
 
-    if(tqueue->crnt->tok->type != TOK_END_OF_INPUT) {
-        if(tqueue->crnt->next == NULL)
+    if(tqueue->type[tqueue->crnt & tqueue->mask] != TOK_END_OF_INPUT) {
+        if(tqueue->crnt + 1 >= tqueue->tail)
             append_token(scan_token());
 
-        tqueue->crnt = tqueue->crnt->next;
+        tqueue->crnt++;
     }
 
-    RETV(tqueue->crnt->tok);
+    RETV(&tqueue->slot[tqueue->crnt & tqueue->mask]);
 }
 
 /**
  * @brief After a rule is parsed, this function sets the head of the token
- * queue to the first unused token. All of the tokens that have been used
- * are discarded and collected by the garbage collector.
+ * queue to the first unused token and the tokens before it are recycled.
+ * This must only be called where no parser function that is still active
+ * can reset the queue to a post before the current token.
  */
 void finalize_token_queue(void) {
 
     ENTER;
 
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    tqueue->head     = tqueue->crnt;
+    TokQueue* tqueue = crnt_token_queue();
+    release_token_queue(tqueue, tqueue->crnt);
 
     RET;
 }
@@ -208,62 +325,70 @@ void kill_token_queue(void) {
 
     ENTER;
 
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    tqueue->head     = NULL;
-    tqueue->crnt     = NULL;
-    tqueue->tail     = NULL;
+    TokQueue* tqueue = crnt_token_queue();
+    release_token_queue(tqueue, tqueue->tail);
+    tqueue->crnt = tqueue->tail;
     append_token(scan_token());
 
     RET;
 }
 
 /**
- * @brief Grab the current queue pointer so that it can be reset when the
- * crnt pointer moves as a result of parsing the line. This is used in
- * conjunction with reset_token_queue(). This should be called and the pointer
+ * @brief Grab the current queue position so that it can be reset when the
+ * crnt index moves as a result of parsing the line. This is used in
+ * conjunction with reset_token_queue(). This should be called and the post
  * saved at the beginning of any parser routine that expects alternatives.
  *
- * @return void*
+ * @return TokPost
  *
  */
-void* post_token_queue(void) {
+TokPost post_token_queue(void) {
 
-    ENTER;
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    assert(tqueue != NULL);
-    RETV((void*)tqueue->crnt);
+    return crnt_token_queue()->crnt;
 }
 
 /**
  * @brief Reset the token stream to the beginning. This is used when a rule
  * could not be matched and the token stream needs to be rewound to test
  * the next rule in a list of alternatives. Call this when a parser
- * alternative fails in order to reset the crnt pointer.
+ * alternative fails in order to reset the crnt index.
  *
- * @return Token*
+ * @param post
  */
-void reset_token_queue(void* post) {
+void reset_token_queue(TokPost post) {
 
     ENTER;
 
     if(!get_recovery_state()) {
         TRACE("recover the queue");
-        TokQueue* tqueue = peek_link_list(tqueue_stack);
-        assert(tqueue != NULL);
+        TokQueue* tqueue = crnt_token_queue();
+        // a post before the head means that a token was finalized too soon
+        assert(post >= tqueue->head && post < tqueue->tail);
 
-        tqueue->crnt = (TokQueueItem*)post;
+        queue_stats.resets++;
+        queue_stats.rewound += (unsigned long)(tqueue->crnt - post);
+        tqueue->crnt = post;
     }
     RET;
 }
 
+/**
+ * @brief Return the counts of what the queue has done for the whole
+ * compile. They are kept for the parser statistics.
+ *
+ * @return const TokQueueStats*
+ */
+const TokQueueStats* get_token_queue_stats(void) {
+
+    return &queue_stats;
+}
+
 void dump_token_queue(void) {
 
-    TokQueue* tqueue = peek_link_list(tqueue_stack);
-    assert(tqueue != NULL);
-    assert(tqueue->head != NULL);
+    TokQueue* tqueue = crnt_token_queue();
 
-    for(TokQueueItem* crnt = tqueue->head; crnt != NULL; crnt = crnt->next) {
-        print_terminal(crnt->tok);
+    for(TokPost pos = tqueue->head; pos < tqueue->tail; pos++) {
+        print_terminal(&tqueue->slot[pos & tqueue->mask]);
         fputc('\n', stdout);
     }
 }
@@ -11,6 +11,12 @@
  * stored in the symbol table to make each variable unique. When the code is
  * translated to C, every variable uses the context to identify it uniquely.
  *
+ * A context is a node that holds one interned name and a link to the
+ * context that it is in. Pushing a name makes one node and copying a
+ * context returns the same pointer, because a context is never changed. The
+ * dotted name is made from the dotted name of the parent the first time
+ * that it is needed, and then kept with its hash.
+ *
  * @author Chuck Tilbury (chucktilbury@gmail.com)
  * @version 0.0
  * @date 2024-05-18
@@ -26,7 +32,8 @@
 #undef USE_TRACE
 #include "trace.h"
 
-static SymContext* _local_context = NULL;
+static _Thread_local SymContext* _local_context = NULL;
+static _Thread_local SymContext* _empty_context = NULL;
 
 typedef struct {
     char* buffer;
@@ -34,77 +41,70 @@ typedef struct {
     int len;
 } _str_buffer;
 
-/**
- * @brief Append a string to the buffer.
- *
- * @param ptr
- * @param str
- */
-static inline void _add_str_buffer(_str_buffer* ptr, const char* str) {
-
-    if(str != NULL) {
-        size_t len = strlen(str);
-
-        if((ptr->len + len + 1) >= (size_t)ptr->cap) {
-            while((ptr->len + len + 1) >= (size_t)ptr->cap)
-                ptr->cap <<= 1;
-            ptr->buffer = _REALLOC_ARRAY(ptr->buffer, char, ptr->cap);
-        }
-
-        memcpy(&ptr->buffer[ptr->len], str, len + 1);
-        ptr->len += len;
-    }
-}
+// scratch space to make the dotted names in
+static _Thread_local _str_buffer _name_buffer = {NULL, 0, 0};
 
 /**
- * @brief Add a character to the string buffer.
+ * @brief Append text to the buffer.
  *
  * @param ptr
- * @param ch
+ * @param str
+ * @param len
  */
-static inline void _add_char_buffer(_str_buffer* ptr, int ch) {
+static inline void _add_str_buffer(_str_buffer* ptr, const char* str, int len) {
 
-    if((ptr->len + 1) >= ptr->cap) {
-        ptr->cap <<= 1;
+    if(ptr->len + len + 1 > ptr->cap) {
+        while(ptr->len + len + 1 > ptr->cap)
+            ptr->cap = (ptr->cap == 0) ? 0x01 << 8 : ptr->cap << 1;
         ptr->buffer = _REALLOC_ARRAY(ptr->buffer, char, ptr->cap);
     }
 
-    ptr->buffer[ptr->len] = (char)ch;
-    ptr->len++;
+    memcpy(&ptr->buffer[ptr->len], str, len);
+    ptr->len += len;
+    ptr->buffer[ptr->len] = '\0';
 }
 
 /**
- * @brief Create a str buffer object
+ * @brief Make a context that is the given one with the name added to the
+ * end. An empty context is not linked to, so a context with one name has
+ * no parent.
  *
- * @return _str_buffer*
+ * @param ptr
+ * @param name
+ * @return SymContext*
  */
-static inline _str_buffer* _create_str_buffer(const char* str) {
+static inline SymContext* _append_sym_context(SymContext* ptr, SymId name) {
 
-    _str_buffer* ptr = _ALLOC_T(_str_buffer);
-    ptr->cap         = 0x01 << 3;
-    ptr->len         = 0;
-    ptr->buffer      = _ALLOC_ARRAY(char, ptr->cap);
+    SymContext* ctx = _ARENA_ALLOC_T(SymContext);
+    ctx->name       = name;
+    ctx->parent     = (ptr != NULL && ptr->depth > 0) ? ptr : NULL;
+    ctx->depth      = (ctx->parent != NULL) ? ctx->parent->depth + 1 : 1;
+    ctx->full       = SYMID_NONE;
 
-    _add_str_buffer(ptr, str);
-
-    return ptr;
+    return ctx;
 }
 
 /**
- * @brief Append the string to the string list and grow the list if required.
+ * @brief Make and keep the dotted name of the context and its hash.
  *
  * @param ptr
- * @param str
  */
-static inline void _append_sym_context(SymContext* ptr, const char* str) {
-
-    if(ptr->len + 1 >= ptr->cap) {
-        ptr->cap <<= 1;
-        ptr->list = _REALLOC_ARRAY(ptr->list, const char*, ptr->cap);
+static void _make_full_name(SymContext* ptr) {
+
+    if(ptr->depth == 0 || ptr->full != SYMID_NONE)
+        return;
+
+    if(ptr->parent == NULL)
+        ptr->full = ptr->name;
+    else {
+        _make_full_name(ptr->parent);
+        _name_buffer.len = 0;
+        _add_str_buffer(&_name_buffer, interned_str(ptr->parent->full), interned_len(ptr->parent->full));
+        _add_str_buffer(&_name_buffer, ".", 1);
+        _add_str_buffer(&_name_buffer, interned_str(ptr->name), interned_len(ptr->name));
+        ptr->full = intern_buf(_name_buffer.buffer, _name_buffer.len);
     }
-
-    ptr->list[ptr->len] = _DUP_STR(str);
-    ptr->len++;
+    ptr->hash = interned_hash(ptr->full);
 }
 
 /******************************************************************************
@@ -119,75 +119,81 @@ static inline void _append_sym_context(SymContext* ptr, const char* str) {
 void init_global_context(void) {
 
     ENTER;
-    if(_local_context == NULL)
-        _local_context = create_sym_context(NULL);
+    if(_local_context == NULL) {
+        _empty_context = create_sym_context(NULL);
+        _local_context = _empty_context;
+    }
     RET;
 }
 
 /**
- * @brief Allocate memory for a new sym context object and push the name on
- * the stack. If the name is NULL, then only add the AST node.
+ * @brief Make a new context that has the name in it. If the name is NULL,
+ * then the context is empty.
  *
  * @return SymContext*
  */
 SymContext* create_sym_context(const char* name) {
 
     ENTER;
-    SymContext* ptr = _ALLOC_T(SymContext);
-    ptr->cap        = 0x01 << 3;
-    ptr->len        = 0;
-    ptr->list       = _ALLOC_ARRAY(const char*, ptr->cap);
+    SymContext* ptr;
 
     if(name != NULL)
-        _append_sym_context(ptr, name);
+        ptr = _append_sym_context(NULL, intern_str(name));
+    else {
+        ptr       = _ARENA_ALLOC_T(SymContext);
+        ptr->name = SYMID_NONE;
+        ptr->full = SYMID_NONE;
+        ptr->hash = interned_hash(SYMID_NONE);
+    }
 
     RETV(ptr);
 }
 
 /**
- * @brief Create a new context and push it on the stack. This is used to
- * maintain the current context as the AST is being traversed.
+ * @brief Add a name to the current context. This is used to maintain the
+ * current context as the AST is being traversed. The contexts that were
+ * copied before are not changed.
  *
  * @param name
- * @param node
  */
-void push_sym_context(const char* name) {
+void push_sym_context(SymId name) {
 
     ENTER;
-    TRACE("name: %s", name);
-    _append_sym_context(_local_context, name);
+    TRACE("name: %s", interned_str(name));
+    _local_context = _append_sym_context(_local_context, name);
     RET;
 }
 
 /**
- * @brief Return the top of stack element and remove it from the stack. This
+ * @brief Return the last name of the current context and remove it. This
  * is called when the current context goes out of scope.
  *
- * @return SymContextNode*
+ * @return SymId
  */
-const char* pop_sym_context(void) {
+SymId pop_sym_context(void) {
 
     ENTER;
-    if(_local_context->len > 0) {
-        _local_context->len--;
-        RETV(_local_context->list[_local_context->len]);
+    if(_local_context->depth > 0) {
+        SymId name     = _local_context->name;
+        _local_context = (_local_context->parent != NULL) ? _local_context->parent : _empty_context;
+        RETV(name);
     }
     else
-        RETV(NULL);
+        RETV(SYMID_NONE);
 }
 
 /**
- * @brief Return the top of stack element but do not remove it.
+ * @brief Return the last name of the current context but do not remove it.
  *
- * @return SymContextNode*
+ * @return SymId
  */
-const char* peek_sym_context(void) {
+SymId peek_sym_context(void) {
 
     ENTER;
-    if(_local_context->len > 0)
-        RETV(_local_context->list[_local_context->len - 1]);
+    if(_local_context->depth > 0)
+        RETV(_local_context->name);
     else
-        RETV(NULL);
+        RETV(SYMID_NONE);
 }
 
 /**
@@ -202,8 +208,8 @@ SymContext* root_sym_context(void) {
 }
 
 /**
- * @brief Create a copy of the given context and return it. After a context
- * has been coppied, it can be pushed and popped like any other.
+ * @brief Return a copy of the given context. A context is never changed,
+ * so the copy is the same context.
  *
  * @param ptr
  * @return SymContext*
@@ -211,14 +217,7 @@ SymContext* root_sym_context(void) {
 SymContext* copy_sym_context(SymContext* ptr) {
 
     ENTER;
-    SymContext* ctx = create_sym_context(NULL);
-
-    int i            = 0;
-    const char* name = NULL;
-    while(NULL != (name = iterate_sym_context(ptr, &i)))
-        _append_sym_context(ctx, name);
-
-    RETV(ctx);
+    RETV(ptr);
 }
 
 /**
@@ -229,13 +228,13 @@ SymContext* copy_sym_context(SymContext* ptr) {
 SymContext* copy_root_context(void) {
 
     ENTER;
-    SymContext* ctx = copy_sym_context(_local_context);
-    RETV(ctx);
+    RETV(_local_context);
 }
 
 /**
- * @brief Return the context as a normal C string. For example to store it.
- * Returns a memory-allocated buffer. Cound be zero length with no error.
+ * @brief Return the context as a normal C string, with the names separated
+ * by '.'. The string is kept with the context and must not be freed. Could
+ * be zero length with no error.
  *
  * @param ptr
  * @return const char*
@@ -243,44 +242,65 @@ SymContext* copy_root_context(void) {
 const char* get_sym_context(SymContext* ptr) {
 
     ENTER;
-    _str_buffer* buf = _create_str_buffer(NULL);
-    int i            = 0;
-    const char* name = iterate_sym_context(ptr, &i);
-
-    // build the return value
-    while(NULL != name) {
-        _add_str_buffer(buf, name);
-        if(NULL != (name = iterate_sym_context(ptr, &i)))
-            _add_char_buffer(buf, '.');
-    }
+    _make_full_name(ptr);
+    const char* str = interned_str(ptr->full);
+    RETV(str);
+}
 
-    RETV(buf->buffer);
+/**
+ * @brief Return the interned ID of the context as a dotted name. This is
+ * the key that the context is stored under in the symbol table.
+ *
+ * @param ptr
+ * @return SymId
+ */
+SymId get_sym_context_id(SymContext* ptr) {
+
+    ENTER;
+    _make_full_name(ptr);
+    RETV(ptr->full);
 }
 
 /**
- * @brief Add a string to the current context. Even if the string has '.' in
- * it, this function will properly add the segments as part of the context.
+ * @brief Return the hash of the dotted name of the context. This is the
+ * same value that the hash table would calculate for the string.
+ *
+ * @param ptr
+ * @return uint32_t
+ */
+uint32_t get_sym_context_hash(SymContext* ptr) {
+
+    ENTER;
+    _make_full_name(ptr);
+    RETV(ptr->hash);
+}
+
+/**
+ * @brief Return a context that is the given one with a string added to it.
+ * Even if the string has '.' in it, this function will properly add the
+ * segments as part of the context.
  *
  * @param ptr
  * @param str
+ * @return SymContext*
  */
-void add_sym_context(SymContext* ptr, const char* str) {
+SymContext* add_sym_context(SymContext* ptr, const char* str) {
 
     ENTER;
-    _str_buffer* buf = _create_str_buffer(str);
-    char* buffer     = buf->buffer;
-    char* tok;
+    while(str != NULL && *str != '\0') {
+        const char* end = strchr(str, '.');
+        size_t len      = (end != NULL) ? (size_t)(end - str) : strlen(str);
 
-    while(NULL != (tok = strtok(buffer, "."))) {
-        _append_sym_context(ptr, tok);
-        buffer = NULL;
+        if(len > 0)
+            ptr = _append_sym_context(ptr, intern_buf(str, len));
+        str = (end != NULL) ? end + 1 : NULL;
     }
-    RET;
+    RETV(ptr);
 }
 
 /**
- * @brief Iterate the context. The post needs to be an int and 0 on the first
- * iteration. Function is reentrant.
+ * @brief Iterate the context from the first name to the last. The post
+ * needs to be an int and 0 on the first iteration. Function is reentrant.
  *
  * @param ptr
  * @param post
@@ -289,8 +309,11 @@ void add_sym_context(SymContext* ptr, const char* str) {
 const char* iterate_sym_context(SymContext* ptr, int* post) {
 
     ENTER;
-    if(ptr->len > *post) {
-        const char* s = ptr->list[*post];
+    if(ptr->depth > *post) {
+        SymContext* ctx = ptr;
+        for(int i = ptr->depth - 1; i > *post; i--)
+            ctx = ctx->parent;
+        const char* s = interned_str(ctx->name);
         *post += 1;
         TRACE("name: %s (%d)", s, *post);
         RETV(s);
@@ -12,24 +12,36 @@
 #ifndef _CONTEXT_H_
 #define _CONTEXT_H_
 
-typedef struct {
-    const char** list;
-    int cap;
-    int len;
+#include "intern.h"
+
+/*
+ * A context is the last name in it and a link to the context that it is in,
+ * so contexts that start the same way share the nodes of the start. A
+ * context is never changed after it is made. The fully qualified name is
+ * made the first time that it is asked for and kept.
+ */
+typedef struct _sym_context_ {
+    SymId name;                   // the last name in the context
+    struct _sym_context_* parent; // the context without the last name
+    int depth;                    // the number of names in the context
+    SymId full;                   // interned dotted name, SYMID_NONE until made
+    uint32_t hash;                // hash of the dotted name
 } SymContext;
 
 #include "ast.h"
 
 void init_global_context(void);
 SymContext* create_sym_context(const char* name);
-void push_sym_context(const char* name);
-const char* pop_sym_context(void);
-const char* peek_sym_context(void);
+void push_sym_context(SymId name);
+SymId pop_sym_context(void);
+SymId peek_sym_context(void);
 SymContext* root_sym_context(void);
 SymContext* copy_sym_context(SymContext* ptr);
 SymContext* copy_root_context(void);
 const char* get_sym_context(SymContext* ptr);
-void add_sym_context(SymContext* ptr, const char* str);
+SymId get_sym_context_id(SymContext* ptr);
+uint32_t get_sym_context_hash(SymContext* ptr);
+SymContext* add_sym_context(SymContext* ptr, const char* str);
 const char* iterate_sym_context(SymContext* ptr, int* post);
 
 #endif  /* _CONTEXT_H_ */
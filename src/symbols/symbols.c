@@ -1,7 +1,17 @@
 /**
  * @file symbols.c
  *
- * @brief
+ * @brief The symbol table is a tree of scopes. Every namespace, class, and
+ * function is a node that holds a table of only the names that are defined
+ * directly inside of it, keyed by their interned IDs. A name is resolved by
+ * looking in the current scope and then in each parent scope, so the cost
+ * of a lookup is one small table probe per level and no names are ever
+ * joined into dotted strings.
+ *
+ * The fully qualified names are only used by find_symtab_node() and
+ * delete_symtab_node(). The index that they use is an array that is indexed
+ * by the interned ID of the dotted name. It is built the first time that it
+ * is needed, and kept up to date after that.
  *
  * @author Chuck Tilbury (chucktilbury@gmail.com)
  * @version 0.0
@@ -9,70 +19,428 @@
  * @copyright Copyright (c) 2024
  *
  */
+#include <stdio.h>
+#include <string.h>
+
 #include "symbols.h"
 #include "hash.h"
 #include "memory.h"
 #include "trace.h"
 
-static HashTable* _local_table;
+typedef struct {
+    SymtabNode** table;
+    int cap;
+    bool built;
+} _symtab_index;
+
+typedef struct {
+    char* buffer;
+    int cap;
+    int len;
+} _name_buffer;
+
+static _Thread_local SymtabNode* _root      = NULL;
+static _Thread_local SymtabNode* _scope     = NULL;
+static _Thread_local int _count             = 0;
+static _Thread_local _symtab_index _index   = {NULL, 0, false};
+static _Thread_local _name_buffer _name_buf = {NULL, 0, 0};
+
+/**
+ * @brief Return the slot that holds the name in the table of the scope, or
+ * the empty slot where it would go.
+ *
+ * @param scope
+ * @param name
+ * @return int
+ */
+static int find_slot(SymtabNode* scope, SymId name) {
+
+    int mask = scope->cap - 1;
+    int slot = (int)name & mask;
+
+    while(scope->table[slot] != NULL && scope->table[slot]->name != name)
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+/**
+ * @brief Return the node of a name that is defined directly in the scope.
+ *
+ * @param scope
+ * @param name
+ * @return SymtabNode*
+ */
+static SymtabNode* find_in_scope(SymtabNode* scope, SymId name) {
+
+    if(scope->table == NULL)
+        return NULL;
+
+    return scope->table[find_slot(scope, name)];
+}
+
+/**
+ * @brief Make the table of the scope twice as large, or create it.
+ *
+ * @param scope
+ */
+static void grow_scope(SymtabNode* scope) {
+
+    int oldcap          = scope->cap;
+    SymtabNode** oldtab = scope->table;
+
+    scope->cap   = (oldcap == 0) ? 0x01 << 3 : oldcap << 1;
+    scope->table = _ALLOC_ARRAY(SymtabNode*, scope->cap);
+
+    for(int i = 0; i < oldcap; i++) {
+        if(oldtab[i] != NULL)
+            scope->table[find_slot(scope, oldtab[i]->name)] = oldtab[i];
+    }
+    _FREE(oldtab);
+}
+
+/**
+ * @brief Take the node out of the table of its scope. The nodes after it in
+ * the probe are placed again so that none of them are lost.
+ *
+ * @param node
+ */
+static void remove_from_scope(SymtabNode* node) {
+
+    SymtabNode* scope = node->parent;
+    int mask          = scope->cap - 1;
+    int slot          = find_slot(scope, node->name);
+
+    scope->table[slot] = NULL;
+    scope->count--;
+    for(slot = (slot + 1) & mask; scope->table[slot] != NULL; slot = (slot + 1) & mask) {
+        SymtabNode* moved  = scope->table[slot];
+        scope->table[slot] = NULL;
+        scope->table[find_slot(scope, moved->name)] = moved;
+    }
+
+    SymtabNode* prev = NULL;
+    for(SymtabNode* crnt = scope->first; crnt != node; crnt = crnt->next)
+        prev = crnt;
+    if(prev == NULL)
+        scope->first = node->next;
+    else
+        prev->next = node->next;
+    if(scope->last == node)
+        scope->last = prev;
+}
+
+/**
+ * @brief Append text to the name buffer.
+ *
+ * @param buf
+ * @param str
+ * @param len
+ */
+static void add_name_buffer(_name_buffer* buf, const char* str, int len) {
+
+    if(buf->len + len + 1 > buf->cap) {
+        while(buf->len + len + 1 > buf->cap)
+            buf->cap = (buf->cap == 0) ? 0x100 : buf->cap << 1;
+        buf->buffer = _REALLOC_ARRAY(buf->buffer, char, buf->cap);
+    }
+
+    memcpy(&buf->buffer[buf->len], str, len);
+    buf->len += len;
+    buf->buffer[buf->len] = '\0';
+}
+
+/**
+ * @brief Write the fully qualified name of the node into the buffer, with
+ * the names of the scopes separated by '.'.
+ *
+ * @param buf
+ * @param node
+ */
+static void add_full_name(_name_buffer* buf, SymtabNode* node) {
+
+    if(node->parent != _root) {
+        add_full_name(buf, node->parent);
+        add_name_buffer(buf, ".", 1);
+    }
+    add_name_buffer(buf, interned_str(node->name), interned_len(node->name));
+}
+
+/**
+ * @brief Return the interned ID of the fully qualified name of the node.
+ *
+ * @param node
+ * @return SymId
+ */
+static SymId full_name_id(SymtabNode* node) {
+
+    _name_buf.len = 0;
+    add_full_name(&_name_buf, node);
+    return intern_buf(_name_buf.buffer, _name_buf.len);
+}
+
+/**
+ * @brief Put the node into the index by its fully qualified name.
+ *
+ * @param node
+ */
+static void index_node(SymtabNode* node) {
+
+    SymId key = full_name_id(node);
+
+    if((int)key >= _index.cap) {
+        int oldcap = _index.cap;
+        if(_index.cap == 0)
+            _index.cap = 0x01 << 3;
+        while((int)key >= _index.cap)
+            _index.cap <<= 1;
+        _index.table = _REALLOC_ARRAY(_index.table, SymtabNode*, _index.cap);
+        memset(&_index.table[oldcap], 0, sizeof(SymtabNode*) * (_index.cap - oldcap));
+    }
+
+    _index.table[key] = node;
+}
+
+/**
+ * @brief Put the node and every node under it into the index.
+ *
+ * @param scope
+ */
+static void index_tree(SymtabNode* scope) {
+
+    for(SymtabNode* node = scope->first; node != NULL; node = node->next) {
+        index_node(node);
+        index_tree(node);
+    }
+}
+
+/**
+ * @brief Take every node under the scope out of the index and free it.
+ *
+ * @param scope
+ */
+static void free_tree(SymtabNode* scope) {
+
+    SymtabNode* next;
+
+    for(SymtabNode* node = scope->first; node != NULL; node = next) {
+        next                             = node->next;
+        _index.table[full_name_id(node)] = NULL;
+        free_tree(node);
+        _FREE(node->table);
+        _FREE(node);
+        _count--;
+    }
+}
+
+/**
+ * @brief Return the node of the fully qualified name.
+ *
+ * @param key
+ * @return SymtabNode*
+ */
+static SymtabNode* find_indexed(SymId key) {
+
+    if(!_index.built) {
+        index_tree(_root);
+        _index.built = true;
+    }
+
+    return ((int)key < _index.cap) ? _index.table[key] : NULL;
+}
+
+/**
+ * @brief Print the nodes under the scope in the order that they were
+ * defined.
+ *
+ * @param scope
+ * @param num
+ */
+static void dump_scope(SymtabNode* scope, int* num) {
+
+    for(SymtabNode* node = scope->first; node != NULL; node = node->next) {
+        _name_buf.len = 0;
+        add_full_name(&_name_buf, node);
+        printf("(%d) key: %s\n", (*num)++, _name_buf.buffer);
+        dump_scope(node, num);
+    }
+}
+
+/******************************************************************************
+ * PUBLIC INTERFACE
+ */
 
 /**
- * @brief Initialize the hash table.
+ * @brief Initialize the symbol table. The root is the global scope.
  *
  */
 SymtabResult init_symbol_table(void) {
 
     ENTER;
-    _local_table = create_hashtable();
+    _root  = _ALLOC_T(SymtabNode);
+    _scope = _root;
+    _count = 0;
     RETV(ST_OK);
 }
 
 /**
- * @brief Create a symbol table node object
+ * @brief Define a name in the current scope.
  *
- * @param key
- * @param type
- * @param scope
- * @param ast_node
- * @return Node*
+ * @param name
+ * @param node
+ * @return SymtabResult
  */
-SymtabResult create_symtab_node(const char* key, void* node) {
+SymtabResult add_symtab_name(SymId name, void* node) {
 
     ENTER;
-    SymtabResult retv = (SymtabResult)insert_hashtable(_local_table, key, node);
-    RETV(retv);
+    if(find_in_scope(_scope, name) != NULL)
+        RETV(ST_DUP);
+
+    if((_scope->count + 1) * 2 > _scope->cap)
+        grow_scope(_scope);
+
+    SymtabNode* ptr = _ALLOC_T(SymtabNode);
+    ptr->name       = name;
+    ptr->ast_node   = node;
+    ptr->parent     = _scope;
+
+    _scope->table[find_slot(_scope, name)] = ptr;
+    _scope->count++;
+    if(_scope->last == NULL)
+        _scope->first = ptr;
+    else
+        _scope->last->next = ptr;
+    _scope->last = ptr;
+    _count++;
+
+    if(_index.built)
+        index_node(ptr);
+
+    RETV(ST_OK);
 }
 
 /**
- * @brief Find the node based on the provided key. If the result pointer
- * is not NULL, then the result of the hash table find will be placed there.
- * If the symbol is not found, then the return value is NULL.
+ * @brief Define a name in the current scope and make it the current scope.
+ * If the name is already defined, then the scope that it has is entered
+ * again, so a namespace can be opened more than once.
  *
- * @param key
- * @param result
+ * @param name
+ * @param node
+ * @return SymtabResult
+ */
+SymtabResult enter_symtab_scope(SymId name, void* node) {
+
+    ENTER;
+    SymtabResult result = add_symtab_name(name, node);
+    _scope              = find_in_scope(_scope, name);
+    RETV(result);
+}
+
+/**
+ * @brief Make the parent of the current scope the current scope.
+ *
+ */
+void leave_symtab_scope(void) {
+
+    ENTER;
+    if(_scope->parent != NULL)
+        _scope = _scope->parent;
+    RET;
+}
+
+/**
+ * @brief Return the current scope.
+ *
+ * @return SymtabNode*
+ */
+SymtabNode* current_symtab_scope(void) {
+
+    return _scope;
+}
+
+/**
+ * @brief Find a name from the current scope. The current scope is looked in
+ * first and then every scope that encloses it, out to the global scope.
+ *
+ * @param name
  * @return SymtabNode*
  */
-void* find_symtab_node(const char* key) {
+SymtabNode* lookup_symtab_name(SymId name) {
 
     ENTER;
-    void* retv = find_hashtable(_local_table, key);
+    SymtabNode* node = NULL;
+
+    for(SymtabNode* scope = _scope; scope != NULL && node == NULL; scope = scope->parent)
+        node = find_in_scope(scope, name);
+
+    RETV(node);
+}
+
+/**
+ * @brief Find a compound name from the current scope. The first name is
+ * found the same way as a simple name and each one after that must be
+ * defined in the scope of the one before it.
+ *
+ * @param names
+ * @param len
+ * @return SymtabNode*
+ */
+SymtabNode* lookup_symtab_path(const SymId* names, int len) {
+
+    ENTER;
+    SymtabNode* node = (len > 0) ? lookup_symtab_name(names[0]) : NULL;
+
+    for(int i = 1; i < len && node != NULL; i++)
+        node = find_in_scope(node, names[i]);
+
+    RETV(node);
+}
+
+/**
+ * @brief Find the node based on the interned ID of its fully qualified
+ * name. If the symbol is not found, then the return value is NULL.
+ *
+ * @param key
+ * @return void*
+ */
+void* find_symtab_node(SymId key) {
+
+    ENTER;
+    SymtabNode* node = find_indexed(key);
+    void* retv       = (node != NULL) ? node->ast_node : NULL;
     RETV(retv);
 }
 
 /**
- * @brief Delete a symbol table entry that
+ * @brief Delete a symbol table entry by the interned ID of its fully
+ * qualified name. The names that are defined inside of it go with it.
  *
  * @param key
  * @return SymtabResult
  */
-SymtabResult delete_symtab_node(const char* key) {
+SymtabResult delete_symtab_node(SymId key) {
 
     ENTER;
-    SymtabResult retv = (SymtabResult)remove_hashtable(_local_table, key);
-    RETV(retv);
+    SymtabNode* node = find_indexed(key);
+    if(node == NULL)
+        RETV(ST_NF);
+
+    for(SymtabNode* scope = _scope; scope != NULL; scope = scope->parent) {
+        if(scope == node) {
+            _scope = node->parent;
+            break;
+        }
+    }
+
+    free_tree(node);
+    remove_from_scope(node);
+    _index.table[key] = NULL;
+    _count--;
+    _FREE(node->table);
+    _FREE(node);
+    RETV(ST_OK);
 }
 
-void dump_hash_table(HashTable*);
 /**
  * @brief Dump the symbol table for debugging.
  *
@@ -80,6 +448,10 @@ void dump_hash_table(HashTable*);
 void dump_symtab(void) {
 
     ENTER;
-    dump_hash_table(_local_table);
+    int num = 0;
+
+    printf("\ncount: %d\n", _count);
+    dump_scope(_root, &num);
+    printf("\n");
     RET;
 }
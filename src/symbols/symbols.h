@@ -21,17 +21,29 @@ typedef enum {
     ST_NF  = HASH_NF,
 } SymtabResult;
 
-// actual list entry
+// a name that is defined in a scope, and the scope of the names that are
+// defined inside of it
 typedef struct _symtab_node_ {
-    const char* key;     // this is taken from the context
-    void* ast_node;      // the AST node that this points to
-    SymContext* context; // full context of this table entry
+    SymId name;                   // the name in the parent scope
+    void* ast_node;               // the AST node that this points to
+    struct _symtab_node_* parent; // the scope that the name is defined in
+    struct _symtab_node_** table; // the names that are defined in this scope
+    int cap;
+    int count;
+    struct _symtab_node_* first;  // the names in the order they were defined
+    struct _symtab_node_* last;
+    struct _symtab_node_* next;
 } SymtabNode;
 
 SymtabResult init_symbol_table(void);
-SymtabResult create_symtab_node(const char* key, void* node);
-void* find_symtab_node(const char* key);
-SymtabResult delete_symtab_node(const char* key);
+SymtabResult add_symtab_name(SymId name, void* node);
+SymtabResult enter_symtab_scope(SymId name, void* node);
+void leave_symtab_scope(void);
+SymtabNode* current_symtab_scope(void);
+SymtabNode* lookup_symtab_name(SymId name);
+SymtabNode* lookup_symtab_path(const SymId* names, int len);
+void* find_symtab_node(SymId key);
+SymtabResult delete_symtab_node(SymId key);
 void dump_symtab(void);
 
 #endif /* _SYMBOLS_H_ */
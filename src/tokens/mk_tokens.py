@@ -1,4 +1,5 @@
 import sys
+import itertools
 
 #with open("keywords.txt", "r") as fh:
 with open(sys.argv[1], "r") as fh:
@@ -20,12 +21,55 @@ hout = header%(
 with open("tokens.h", "w") as fh:
     fh.write(hout)
 
+# Find a perfect hash for the keywords. The hash combines the length of the
+# word with the first, middle, and last characters, folded to lower case.
+# This has to match keyword_hash() in tokens.c.template. Keywords are not
+# case sensitive, so the folded words must be unique.
+def fold(ch):
+    return ord(ch) | 0x20
+
+def keyword_hash(word, mult, size):
+    n = len(word)
+    return (n * mult[0] + fold(word[0]) * mult[1] +
+            fold(word[n >> 1]) * mult[2] + fold(word[n - 1]) * mult[3]) & (size - 1)
+
+def find_hash(words):
+    size = 1
+    while size < len(words) * 2:
+        size <<= 1
+
+    while size <= 1024:
+        for mult in itertools.product(range(1, 32), repeat = 4):
+            slots = set(keyword_hash(w, mult, size) for w in words)
+            if len(slots) == len(words):
+                return (mult, size)
+        size <<= 1
+
+    sys.stderr.write("mk_tokens.py: cannot find a perfect hash for the keywords\n")
+    sys.exit(1)
+
+words = sorted(w.strip() for w in word_list if w.strip())
+if len(set(w.lower() for w in words)) != len(words):
+    sys.stderr.write("mk_tokens.py: duplicate keyword in %s\n"%(sys.argv[1]))
+    sys.exit(1)
+
+(mult, size) = find_hash(words)
+table = [None] * size
+for w in words:
+    table[keyword_hash(w, mult, size)] = w
+
 sec1 = "\n".join("    { \"%s\", TOK_%s },"%(
             w.strip(), w.strip().upper()) for w in sorted(word_list))
 sec2 = "\n".join("        (tok->type == TOK_%s)? \"%s\" :"%(
             w.strip().upper(), w.strip()) for w in word_list)
+sec3 = "\n".join(
+            ("    { \"%s\", %d, TOK_%s },"%(w, len(w), w.upper())
+                if w is not None else "    { NULL, 0, TOK_SYMBOL },")
+            for w in table)
 
-cout = source%(sec1, sec2)
+cout = source%(mult[0], mult[1], mult[2], mult[3], size,
+               min(len(w) for w in words), max(len(w) for w in words),
+               sec1, sec3, sec2)
 
 with open("tokens.c", "w") as fh:
     fh.write(cout)
@@ -0,0 +1,194 @@
+/**
+ * @file hash_bench.c
+ *
+ * @brief Hash table benchmark. This fills tables with names like the ones
+ * that the symbol tables hold and reports the number of lookups per second
+ * for keys that are in the table and keys that are not. The histogram shows
+ * how far each entry is from its home slot, which is one less than the
+ * number of slots that a lookup of it looks at.
+ *
+ *  usage: hash_bench [-n keys] [-r repeats]
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hash.h"
+#include "memory.h"
+#include "trace.h"
+
+#define MAX_HIST 16
+
+static const char* formats[] = {
+    "name_space_%d",
+    "SomeClass%d",
+    "method_%d",
+    "value_one_%d",
+    "some.compound.name%d",
+    "a%d",
+};
+
+static double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1.0e9;
+}
+
+/*
+ * Make count names. The names with base added to the number are different
+ * from the ones without, so they are used for lookups that miss.
+ */
+static char** make_keys(int count, int base) {
+
+    char** keys = _ALLOC_ARRAY(char*, count);
+    char buf[64];
+
+    for(int i = 0; i < count; i++) {
+        snprintf(buf, sizeof(buf), formats[i % (sizeof(formats) / sizeof(formats[0]))], i + base);
+        keys[i] = _DUP_STR(buf);
+    }
+
+    return keys;
+}
+
+static void free_keys(char** keys, int count) {
+
+    for(int i = 0; i < count; i++)
+        _FREE(keys[i]);
+    _FREE(keys);
+}
+
+/*
+ * Look up every key, repeats times, and return the best time of one pass.
+ */
+static double lookup(HashTable* tab, char** keys, int count, int repeats, long* found) {
+
+    double best = 0.0;
+
+    for(int r = 0; r < repeats; r++) {
+        long hits    = 0;
+        double start = now();
+        for(int i = 0; i < count; i++)
+            hits += (find_hashtable(tab, keys[i]) != NULL);
+        double time = now() - start;
+        if(r == 0 || time < best)
+            best = time;
+        *found = hits;
+    }
+
+    return best;
+}
+
+/*
+ * Count the entries by how far they are from their home slot.
+ */
+static int probe_hist(HashTable* tab, long* hist) {
+
+    int longest = 0;
+
+    memset(hist, 0, sizeof(long) * MAX_HIST);
+    for(int i = 0; i < tab->cap; i++) {
+        if(tab->table[i].key != NULL) {
+            int dist = (int)(((uint32_t)i - tab->table[i].hash) & (tab->cap - 1));
+            hist[(dist < MAX_HIST) ? dist : MAX_HIST - 1]++;
+            if(dist > longest)
+                longest = dist;
+        }
+    }
+
+    return longest;
+}
+
+static void run(int count, int repeats) {
+
+    char** keys   = make_keys(count, 0);
+    char** misses = make_keys(count, 1 << 24);
+    long found;
+    long hist[MAX_HIST];
+
+    double start   = now();
+    HashTable* tab = create_hashtable();
+    for(int i = 0; i < count; i++)
+        insert_hashtable(tab, keys[i], keys[i]);
+    double insert = now() - start;
+
+    start           = now();
+    HashTable* bulk = create_hashtable();
+    insert_hashtable_bulk(bulk, (const char**)keys, (void**)keys, count);
+    double bulk_time = now() - start;
+
+    double hit = lookup(tab, keys, count, repeats, &found);
+    if(found != count)
+        printf("hash: error: %ld of %d keys found\n", found, count);
+    double miss = lookup(tab, misses, count, repeats, &found);
+    if(found != 0)
+        printf("hash: error: %ld missing keys found\n", found);
+
+    int longest = probe_hist(tab, hist);
+
+    printf("hash: %d keys, capacity %d, load %.2f\n", count, tab->cap, (double)tab->count / tab->cap);
+    printf("hash: insert %.0f/sec, bulk insert %.0f/sec\n", count / insert, count / bulk_time);
+    printf("hash: lookups %.0f/sec hit, %.0f/sec miss\n", count / hit, count / miss);
+    printf("hash: distance from home, longest %d:", longest);
+    for(int i = 0; i < MAX_HIST && i <= longest; i++)
+        printf(" %s%d:%ld", (i == MAX_HIST - 1) ? ">=" : "", i, hist[i]);
+    printf("\n");
+
+    // remove half of the keys and make sure that the rest are still found
+    for(int i = 0; i < count; i += 2)
+        remove_hashtable(tab, keys[i]);
+    long left = 0;
+    for(int i = 0; i < count; i++)
+        left += (find_hashtable(tab, keys[i]) != NULL);
+    if(left != count / 2 || tab->count != count / 2)
+        printf("hash: error: %ld of %d keys found after remove\n", left, count / 2);
+
+    destroy_hashtable(tab);
+    destroy_hashtable(bulk);
+    free_keys(keys, count);
+    free_keys(misses, count);
+}
+
+int main(int argc, char** argv) {
+
+    int count   = 0;
+    int repeats = 5;
+    int opt;
+
+    INIT_TRACE;
+    SET_TRACE_STATE(false);
+
+    while((opt = getopt(argc, argv, "n:r:")) != -1) {
+        switch(opt) {
+            case 'n':
+                count = (int)strtol(optarg, NULL, 10);
+                break;
+            case 'r':
+                repeats = (int)strtol(optarg, NULL, 10);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n keys] [-r repeats]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    if(count > 0)
+        run(count, repeats);
+    else {
+        // the sizes of a scope, a module, and a large program
+        run(64, repeats * 1000);
+        run(4096, repeats * 20);
+        run(1 << 18, repeats);
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file scan_bench.c
+ *
+ * @brief Scanner throughput benchmark. This runs the raw scanner over a
+ * large input and reports the number of tokens scanned per second. If no
+ * file name is given, then a synthetic input of several megabytes is
+ * generated in a temporary file using the same constructs that appear in
+ * the parser tests.
+ *
+ * The -c option generates an input that is heavy with comments, long
+ * strings, and indentation instead.
+ *
+ *  usage: scan_bench [-c] [-m megabytes] [-r repeats] [file]
+ *
+ * @author Charles Tilbury (chucktilbury@gmail.com)
+ * @version 0.0
+ * @date 10-18-2026
+ * @copyright Copyright (c) 2026
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fastscan.h"
+#include "scanner.h"
+#include "trace.h"
+
+extern Token* scan_token(void);
+
+static const char* sample = "; namespace number %d\n"
+                            "namespace name_space_%d {\n"
+                            "    class SomeClass%d(BaseClass) {\n"
+                            "        public\n"
+                            "        var float value_one\n"
+                            "        func method(signed, float)(float)\n"
+                            "    }\n"
+                            "    func some_func(signed a, float b)(float) {\n"
+                            "        var float result = (a + b * 1.5e3) / 0x1F\n"
+                            "        var string text = \"a \\\"quoted\\\" string\\n\"\n"
+                            "        var string raw = 'single quoted string'\n"
+                            "        while(a <= 100 and b != 0.25) {\n"
+                            "            a += 1 ; count up\n"
+                            "            b -= some.compound.name[a]\n"
+                            "        }\n"
+                            "        if(a == 12345) { return(result) }\n"
+                            "        else { print(text, raw) }\n"
+                            "    }\n"
+                            "}\n\n";
+
+static const char* heavy_sample =
+        "; ------------------------------------------------------------------\n"
+        "; This is a long descriptive comment about the function number %d,\n"
+        "; the way that a function is documented in a real source file.\n"
+        "; ------------------------------------------------------------------\n"
+        "func documented_%d(string s)(string) {\n"
+        "        var string text = \"a long double quoted string that does not have "
+        "any escapes in it until the very end of it\\n\"\n"
+        "        var string raw = 'a long single quoted string that is copied "
+        "as it is without looking at any of the characters in it'\n"
+        "                                return(text) ; %d\n"
+        "}\n\n";
+
+static double now(void) {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1.0e9;
+}
+
+/*
+ * Write the synthetic input and return the number of bytes written.
+ */
+static long make_input(const char* fname, const char* text, long size) {
+
+    FILE* fp = fopen(fname, "w");
+    if(fp == NULL) {
+        perror(fname);
+        exit(1);
+    }
+
+    long total = 0;
+    for(int i = 0; total < size; i++)
+        total += fprintf(fp, text, i, i, i);
+
+    fclose(fp);
+    return total;
+}
+
+/*
+ * Scan the whole file and return the number of tokens.
+ */
+static long scan_file(const char* fname, bool first) {
+
+    long count = 0;
+
+    // init_scanner() opens the file and reads the first token.
+    if(first)
+        init_scanner(fname);
+    else
+        open_file(fname);
+    count++;
+
+    while(token_type(scan_token()) != TOK_END_OF_FILE)
+        count++;
+
+    close_file();
+    return count;
+}
+
+int main(int argc, char** argv) {
+
+    long megs        = 8;
+    int repeats      = 5;
+    char* fname      = NULL;
+    const char* text = sample;
+    char tmp[64]     = "/tmp/scan_bench_XXXXXX";
+    int opt;
+
+    INIT_TRACE;
+    SET_TRACE_STATE(false);
+
+    while((opt = getopt(argc, argv, "cm:r:")) != -1) {
+        switch(opt) {
+            case 'c':
+                text = heavy_sample;
+                break;
+            case 'm':
+                megs = strtol(optarg, NULL, 10);
+                break;
+            case 'r':
+                repeats = (int)strtol(optarg, NULL, 10);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-c] [-m megabytes] [-r repeats] [file]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    if(optind < argc)
+        fname = argv[optind];
+    else {
+        int fd = mkstemp(tmp);
+        if(fd < 0) {
+            perror(tmp);
+            return 1;
+        }
+        close(fd);
+        make_input(tmp, text, megs * 1024 * 1024);
+        fname = tmp;
+    }
+
+    long tokens = 0;
+    double best = 0.0;
+    for(int i = 0; i < repeats; i++) {
+        double start = now();
+        tokens       = scan_file(fname, i == 0);
+        double time  = now() - start;
+        if(i == 0 || time < best)
+            best = time;
+    }
+
+    FILE* fp = fopen(fname, "r");
+    fseek(fp, 0, SEEK_END);
+    long bytes = ftell(fp);
+    fclose(fp);
+
+    printf("scan: %s (%s)\n", fname, fastscan_name());
+    printf("scan: %ld bytes, %ld tokens, best of %d: %.4f sec\n", bytes, tokens, repeats, best);
+    printf("scan: %.0f tokens/sec, %.1f MB/sec\n", tokens / best,
+           (double)bytes / (1024.0 * 1024.0) / best);
+
+    if(fname == tmp)
+        unlink(tmp);
+
+    return 0;
+}
@@ -109,14 +109,25 @@ class Compiler:
                 pass
 
         try :
-            # call the compiler
+            # call the compiler once for each set of arguments, in the
+            # directory of the test so that the modules it imports are found
+            dirname = os.path.dirname(name)
             ofh = open(oname+'.temp', 'w')
             efh = open(ename+'.temp', 'w')
-            pr = subprocess.run([self.comp_name, name+'.k'], text=True, stdout=ofh, stderr=efh)
+            before = set(os.listdir(dirname))
+            for args in self.read_args(name):
+                pr = subprocess.run([self.comp_name]+args+[name+'.k'], text=True,
+                                    stdout=ofh, stderr=efh, cwd=dirname)
+                # a test can expect the compiler to stop with an error
+                if pr.returncode != 0:
+                    efh.write("exit code %d\n"%(pr.returncode))
+                    break
             ofh.close()
             efh.close()
-            if pr.returncode != 0:
-                return "compiler returned error code %d"%(pr.returncode)
+
+            # remove what the compiler wrote, such as interface files
+            for fname in set(os.listdir(dirname)) - before:
+                os.remove(os.path.join(dirname, fname))
             
         except Exception as e:
             with open(os.path.join(dir, name+".error"), "w") as fp :
@@ -125,6 +136,24 @@ class Compiler:
         
         return "OK"
     
+    def read_args(self, name):
+        '''
+        Return a list of the command line arguments of each run of the
+        compiler. If there is a file with the name of the test and ".args",
+        then each line of it that is not blank is one run. Otherwise the
+        compiler is run once with no arguments.
+        '''
+        if not os.path.isfile(name+'.args'):
+            return [[]]
+
+        runs = []
+        with open(name+'.args', 'r') as fp:
+            for line in fp.readlines():
+                s = line.split("#")[0].split()
+                if len(s) > 0:
+                    runs.append(s)
+        return runs
+
     def clean(self, name):
         '''
         Clean up the files created bu the run method.